@@ -0,0 +1,501 @@
+// =================================================================
+// ListBenchmark.cpp
+//  Description     Throughput & latency benchmarks for the list classes
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <libcds/DoublyLinkedList.hpp>
+#include <libcds/FineGrainedDoublyLinkedList.hpp>
+#include <libcds/LinkedList.hpp>
+#include <libcds/LockFreeLinkedList.hpp>
+#include <libcds/UnrolledLinkedList.hpp>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <util.hpp>
+#include <vector>
+
+namespace CdsBench
+{
+    using Clock = std::chrono::steady_clock;
+
+    // the operations under test
+    enum Op
+    {
+        OpInsert,
+        OpSearch,
+        OpRemove,
+        OpGet,
+        OpIndexOf,
+        OpCount
+    };
+
+    const char* OpNames[OpCount] = {"Insert", "Search", "Remove", "Get", "IndexOf"};
+
+    /**
+     * IAdapter -- uniform face over the structures being measured, so one
+     *  driver can run them all. Values are uint32_t throughout.
+     */
+    class IAdapter
+    {
+    public:
+        virtual ~IAdapter() {}
+
+        // cheapest way to grow the structure, used while prefilling
+        virtual void Prefill(uint32_t value) = 0;
+
+        virtual bool Insert(uint32_t value, size_t index) = 0;
+        virtual bool Search(uint32_t value) = 0;
+        virtual bool Remove(uint32_t value) = 0;
+        virtual bool Get(size_t index) = 0;
+        virtual size_t IndexOf(uint32_t value) = 0;
+        virtual size_t Size() = 0;
+
+        // unsynchronized baselines only run single-threaded
+        virtual bool ThreadSafe() const = 0;
+    };
+
+    // any of the CDS lists. Get() results are never dereferenced, since
+    // another thread may remove the element right after.
+    template <typename L>
+    class CdsAdapter : public IAdapter
+    {
+        static_assert(CDS::IsList<L, uint32_t>::value, "CdsAdapter needs a CDS list");
+
+    private:
+        L list;
+
+    public:
+        void Prefill(uint32_t value) override { list.Insert(value); }
+        bool Insert(uint32_t value, size_t index) override { return list.Insert(value, index); }
+        bool Search(uint32_t value) override { return list.Search(value); }
+        bool Remove(uint32_t value) override { return list.Remove(value); }
+        bool Get(size_t index) override { return list.Get(index) != nullptr; }
+        size_t IndexOf(uint32_t value) override { return list.IndexOf(value); }
+        size_t Size() override { return list.Size(); }
+        bool ThreadSafe() const override { return true; }
+    };
+
+    // std::list and std::vector share one adapter
+    template <typename C>
+    class StdAdapter : public IAdapter
+    {
+    protected:
+        C c;
+
+        typename C::iterator At(size_t index)
+        {
+            return std::next(c.begin(), static_cast<std::ptrdiff_t>(index));
+        }
+
+    public:
+        void Prefill(uint32_t value) override { c.push_back(value); }
+
+        bool Insert(uint32_t value, size_t index) override
+        {
+            if (index > c.size())
+                return false;
+            c.insert(At(index), value);
+            return true;
+        }
+
+        bool Search(uint32_t value) override { return std::find(c.begin(), c.end(), value) != c.end(); }
+
+        bool Remove(uint32_t value) override
+        {
+            auto it = std::find(c.begin(), c.end(), value);
+            if (it == c.end())
+                return false;
+            c.erase(it);
+            return true;
+        }
+
+        bool Get(size_t index) override
+        {
+            if (index >= c.size())
+                return false;
+            volatile uint32_t value = *At(index);
+            (void)value;
+            return true;
+        }
+
+        size_t IndexOf(uint32_t value) override
+        {
+            auto it = std::find(c.begin(), c.end(), value);
+            return it == c.end() ? static_cast<size_t>(-1) : static_cast<size_t>(std::distance(c.begin(), it));
+        }
+
+        size_t Size() override { return c.size(); }
+        bool ThreadSafe() const override { return false; }
+    };
+
+    // std::list behind one std::mutex, the "obvious" thread-safe baseline
+    class MutexListAdapter : public StdAdapter<std::list<uint32_t>>
+    {
+    private:
+        using Base = StdAdapter<std::list<uint32_t>>;
+        std::mutex mtx;
+
+    public:
+        bool Insert(uint32_t value, size_t index) override
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            return Base::Insert(value, index);
+        }
+        bool Search(uint32_t value) override
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            return Base::Search(value);
+        }
+        bool Remove(uint32_t value) override
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            return Base::Remove(value);
+        }
+        bool Get(size_t index) override
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            return Base::Get(index);
+        }
+        size_t IndexOf(uint32_t value) override
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            return Base::IndexOf(value);
+        }
+        size_t Size() override
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            return Base::Size();
+        }
+        bool ThreadSafe() const override { return true; }
+    };
+
+    // name + factory for each structure
+    struct Structure
+    {
+        const char* name;
+        std::function<std::unique_ptr<IAdapter>()> make;
+    };
+
+    template <typename A>
+    Structure
+    MakeStructure(const char* name)
+    {
+        return {name, []() -> std::unique_ptr<IAdapter> { return std::unique_ptr<IAdapter>(new A()); }};
+    }
+
+    std::vector<Structure>
+    AllStructures()
+    {
+        return {
+            MakeStructure<CdsAdapter<CDS::LinkedList<uint32_t>>>("LinkedList"),
+            MakeStructure<CdsAdapter<CDS::LinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>>("LinkedList<SharedLock>"),
+            MakeStructure<CdsAdapter<CDS::DoublyLinkedList<uint32_t>>>("DoublyLinkedList"),
+            MakeStructure<CdsAdapter<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>>("DoublyLinkedList<SharedLock>"),
+            MakeStructure<CdsAdapter<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::ExclusiveLock, CDS::HashIndex>>>("DoublyLinkedList<HashIndex>"),
+            MakeStructure<CdsAdapter<CDS::FineGrainedDoublyLinkedList<uint32_t>>>("FineGrainedDoublyLinkedList"),
+            MakeStructure<CdsAdapter<CDS::LockFreeLinkedList<uint32_t>>>("LockFreeLinkedList"),
+            MakeStructure<CdsAdapter<CDS::UnrolledLinkedList<uint32_t>>>("UnrolledLinkedList"),
+            MakeStructure<StdAdapter<std::list<uint32_t>>>("std::list"),
+            MakeStructure<StdAdapter<std::vector<uint32_t>>>("std::vector"),
+            MakeStructure<MutexListAdapter>("std::list+mutex"),
+        };
+    }
+
+    // everything that defines one measurement
+    struct Config
+    {
+        std::vector<size_t> threads;
+        std::vector<size_t> sizes;
+        std::vector<unsigned> readPercents;
+        std::vector<std::string> only;
+        unsigned durationMs = 100;
+        std::string format = "csv";
+        std::string out;
+    };
+
+    // one row of output
+    struct Result
+    {
+        std::string structure;
+        size_t size;
+        size_t threads;
+        unsigned readPercent;
+        const char* op;
+        size_t count;
+        double opsPerSec;
+        uint64_t p50;
+        uint64_t p99;
+        uint64_t p999;
+    };
+
+    // nearest-rank percentile of sorted samples
+    uint64_t
+    Percentile(const std::vector<uint64_t>& sorted, double p)
+    {
+        if (sorted.empty())
+            return 0;
+        size_t rank = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[rank];
+    }
+
+    // runs one (structure, size, threads, read%) cell and appends its rows
+    void
+    RunCell(const Structure& s, size_t size, size_t threads, unsigned readPercent, unsigned durationMs, std::vector<Result>& results)
+    {
+        std::unique_ptr<IAdapter> adapter = s.make();
+        const uint32_t range = static_cast<uint32_t>(size * 2 + 1);
+
+        // prefill with values from [0, 2 * size]
+        uint32_t seed = 0x9E3779B9u;
+        for (size_t i = 0; i < size; ++i)
+        {
+            seed = CdsUtil::xorshift32(seed);
+            adapter->Prefill(seed % range);
+        }
+
+        // per-thread, per-op latency samples in nanoseconds
+        std::vector<std::vector<std::vector<uint64_t>>> samples(threads, std::vector<std::vector<uint64_t>>(OpCount));
+        std::atomic<size_t> ready(0);
+        std::atomic<bool> go(false);
+        const auto duration = std::chrono::milliseconds(durationMs);
+
+        // reads and writes are each split evenly among their ops
+        static const Op readOps[] = {OpSearch, OpGet, OpIndexOf};
+        static const Op writeOps[] = {OpInsert, OpRemove};
+
+        auto worker = [&](size_t id)
+        {
+            uint32_t rng = static_cast<uint32_t>(0x2545F491u * (id + 1));
+            auto& mine = samples[id];
+            ready++;
+            while (!go.load())
+                std::this_thread::yield();
+
+            const auto end = Clock::now() + duration;
+            auto now = Clock::now();
+            while (now < end)
+            {
+                rng = CdsUtil::xorshift32(rng);
+                uint32_t value = rng % range;
+                bool read = (rng >> 8) % 100 < readPercent;
+                Op op = read ? readOps[(rng >> 16) % 3] : writeOps[(rng >> 16) % 2];
+
+                auto start = now;
+                switch (op)
+                {
+                case OpInsert:
+                    adapter->Insert(value, (rng >> 4) % (adapter->Size() + 1));
+                    break;
+                case OpSearch:
+                    adapter->Search(value);
+                    break;
+                case OpRemove:
+                    adapter->Remove(value);
+                    break;
+                case OpGet:
+                    adapter->Get((rng >> 4) % (adapter->Size() + 1));
+                    break;
+                default:
+                    adapter->IndexOf(value);
+                    break;
+                }
+                now = Clock::now();
+                mine[op].push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - start).count()));
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (size_t i = 0; i < threads; ++i)
+            pool.emplace_back(worker, i);
+        while (ready.load() < threads)
+            std::this_thread::yield();
+        go.store(true);
+        for (std::thread& t : pool)
+            t.join();
+
+        // merge and summarize each op
+        const double seconds = durationMs / 1000.0;
+        for (size_t op = 0; op < OpCount; ++op)
+        {
+            std::vector<uint64_t> merged;
+            for (size_t t = 0; t < threads; ++t)
+                merged.insert(merged.end(), samples[t][op].begin(), samples[t][op].end());
+            if (merged.empty())
+                continue;
+            std::sort(merged.begin(), merged.end());
+
+            results.push_back({s.name, size, threads, readPercent, OpNames[op], merged.size(),
+                               static_cast<double>(merged.size()) / seconds,
+                               Percentile(merged, 0.50), Percentile(merged, 0.99), Percentile(merged, 0.999)});
+        }
+    }
+
+    void
+    WriteCsv(std::ostream& os, const std::vector<Result>& results)
+    {
+        os << "structure,size,threads,read_pct,op,count,ops_per_sec,p50_ns,p99_ns,p999_ns\n";
+        for (const Result& r : results)
+        {
+            os << '"' << r.structure << "\"," << r.size << ',' << r.threads << ',' << r.readPercent << ','
+               << r.op << ',' << r.count << ',' << static_cast<uint64_t>(r.opsPerSec) << ','
+               << r.p50 << ',' << r.p99 << ',' << r.p999 << '\n';
+        }
+    }
+
+    void
+    WriteJson(std::ostream& os, const std::vector<Result>& results)
+    {
+        os << "[\n";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& r = results[i];
+            os << "  {\"structure\": \"" << r.structure << "\", \"size\": " << r.size
+               << ", \"threads\": " << r.threads << ", \"read_pct\": " << r.readPercent
+               << ", \"op\": \"" << r.op << "\", \"count\": " << r.count
+               << ", \"ops_per_sec\": " << static_cast<uint64_t>(r.opsPerSec)
+               << ", \"p50_ns\": " << r.p50 << ", \"p99_ns\": " << r.p99 << ", \"p999_ns\": " << r.p999
+               << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        os << "]\n";
+    }
+
+    // parses "1,2,4" into a list of numbers
+    template <typename N>
+    std::vector<N>
+    ParseList(const char* text)
+    {
+        std::vector<N> out;
+        std::stringstream ss(text);
+        std::string item;
+        while (std::getline(ss, item, ','))
+        {
+            if (!item.empty())
+                out.push_back(static_cast<N>(std::stoull(item)));
+        }
+        return out;
+    }
+
+    void
+    Usage()
+    {
+        printf("usage: ListBenchmark [options]\n"
+               "  --threads=1,2,4       thread counts (default: powers of two up to the core count)\n"
+               "  --sizes=10,1000       prefilled list sizes (default: 10,1000,100000)\n"
+               "  --reads=50,95         percentage of read-only operations (default: 50,95)\n"
+               "  --duration-ms=100     time spent in each cell\n"
+               "  --only=LinkedList,... restrict to the named structures\n"
+               "  --format=csv|json     output format (default: csv)\n"
+               "  --out=path            write results to path instead of stdout\n");
+    }
+
+    // parses argv into config. Returns false on bad input.
+    bool
+    ParseArgs(int argc, char** argv, Config& config)
+    {
+        size_t cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+        for (size_t t = 1; t <= cores; t *= 2)
+            config.threads.push_back(t);
+        if (config.threads.back() != cores)
+            config.threads.push_back(cores);
+        config.sizes = {10, 1000, 100000};
+        config.readPercents = {50, 95};
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const char* arg = argv[i];
+            const char* eq = std::strchr(arg, '=');
+            std::string key = eq ? std::string(arg, eq) : std::string(arg);
+            const char* value = eq ? eq + 1 : "";
+
+            if (key == "--threads")
+                config.threads = ParseList<size_t>(value);
+            else if (key == "--sizes")
+                config.sizes = ParseList<size_t>(value);
+            else if (key == "--reads")
+                config.readPercents = ParseList<unsigned>(value);
+            else if (key == "--duration-ms")
+                config.durationMs = static_cast<unsigned>(std::stoul(value));
+            else if (key == "--format")
+                config.format = value;
+            else if (key == "--out")
+                config.out = value;
+            else if (key == "--only")
+            {
+                std::stringstream ss(value);
+                std::string item;
+                while (std::getline(ss, item, ','))
+                    config.only.push_back(item);
+            }
+            else
+                return false;
+        }
+        return config.format == "csv" || config.format == "json";
+    }
+} // namespace CdsBench
+
+int
+main(int argc, char** argv)
+{
+    using namespace CdsBench;
+
+    Config config;
+    if (!ParseArgs(argc, argv, config))
+    {
+        Usage();
+        return 1;
+    }
+
+    std::vector<Result> results;
+    for (const Structure& s : AllStructures())
+    {
+        if (!config.only.empty() && std::find(config.only.begin(), config.only.end(), s.name) == config.only.end())
+            continue;
+
+        bool threadSafe = s.make()->ThreadSafe();
+        for (size_t size : config.sizes)
+        {
+            for (size_t threads : config.threads)
+            {
+                // unsynchronized baselines are single-threaded only
+                if (!threadSafe && threads > 1)
+                    continue;
+                for (unsigned reads : config.readPercents)
+                {
+                    fprintf(stderr, "%s size=%zu threads=%zu reads=%u%%\n", s.name, size, threads, reads);
+                    RunCell(s, size, threads, reads, config.durationMs, results);
+                }
+            }
+        }
+    }
+
+    // emit to a file or stdout
+    std::ofstream file;
+    if (!config.out.empty())
+    {
+        file.open(config.out);
+        if (!file)
+        {
+            fprintf(stderr, "unable to open %s\n", config.out.c_str());
+            return 1;
+        }
+    }
+    std::ostream& os = config.out.empty() ? std::cout : file;
+    if (config.format == "json")
+        WriteJson(os, results);
+    else
+        WriteCsv(os, results);
+    return 0;
+}
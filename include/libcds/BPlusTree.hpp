@@ -0,0 +1,179 @@
+// =================================================================
+// BPlusTree.hpp
+//  Description     Declaration of BPlusTree
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_BPLUSTREE_HPP
+#define CDS_BPLUSTREE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <libcds/DataStructure.hpp>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace CDS
+{
+    /**
+     * BPlusTree - Class to create an ordered set over a B+ tree.
+     * Features:
+     *      Templated key type and comparator
+     *      Nodes span NodeLines cache lines, searched with a binary search
+     *      Leaves linked in key order for range scans
+     *      O(n) BulkLoad from sorted input
+     *      Optimistic lock coupling: readers take no locks at all
+     *      Destructor
+     *
+     * Every node carries a version. Readers note the version, read the node,
+     * and check the version again, restarting from the root if a writer got
+     * in between. Writers lock only the nodes they change, by bumping the
+     * version. Full inner nodes are split on the way down, so a split never
+     * has to climb more than one level.
+     *
+     * Remove does not merge underfull nodes; later inserts reuse the space,
+     * and Clear or BulkLoad rebuild the tree. Nodes dropped by Clear or
+     * BulkLoad are recycled by later splits rather than freed, since readers
+     * may still be inside them, and are only freed by the destructor.
+     */
+    template <typename T, typename Compare = std::less<T>, size_t NodeLines = 4>
+    class BPlusTree final : ITree<T>
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "BPlusTree keys must be trivially copyable, since readers copy them without locking");
+
+    public:
+        // bytes per node
+        static constexpr size_t NodeSize = NodeLines * CacheLineSize;
+
+    private:
+        // version bits. The rest of the version counts writes.
+        static constexpr uint64_t Obsolete = 1;
+        static constexpr uint64_t Locked = 2;
+
+        struct Node
+        {
+            std::atomic<uint64_t> version;
+            std::atomic<uint16_t> count;
+            const bool leaf;
+
+            explicit Node(bool leaf) : version(0), count(0), leaf(leaf) {}
+        };
+
+    public:
+        // keys per leaf, and keys per inner node (which has one more child)
+        static constexpr size_t LeafCapacity = (NodeSize - sizeof(Node) - sizeof(void*)) / sizeof(std::atomic<T>);
+        static constexpr size_t InnerCapacity = (NodeSize - sizeof(Node) - sizeof(void*)) / (sizeof(std::atomic<T>) + sizeof(void*));
+
+    private:
+        static_assert(InnerCapacity >= 3 && LeafCapacity >= 3, "BPlusTree nodes are too small for this key type, raise NodeLines");
+        static_assert(LeafCapacity <= UINT16_MAX, "BPlusTree nodes are too large, lower NodeLines");
+
+        struct alignas(CacheLineSize) Leaf : Node
+        {
+            std::atomic<Leaf*> next;
+            std::atomic<T> keys[LeafCapacity];
+
+            Leaf() : Node(true), next(nullptr) {}
+        };
+
+        struct alignas(CacheLineSize) Inner : Node
+        {
+            std::atomic<T> keys[InnerCapacity];
+            std::atomic<Node*> children[InnerCapacity + 1];
+
+            Inner() : Node(false) {}
+        };
+
+        static_assert(sizeof(Leaf) == NodeSize && sizeof(Inner) == NodeSize, "BPlusTree nodes must fill whole cache lines");
+
+        std::atomic<Node*> root;
+        std::atomic<size_t> height;
+        std::atomic<size_t> size;
+        Compare comp;
+
+        // serializes Clear and BulkLoad, which swap out the whole tree
+        std::mutex replaceMtx;
+
+        // nodes dropped by Clear and BulkLoad, reused by later splits
+        std::mutex poolMtx;
+        std::vector<Leaf*> freeLeaves;
+        std::vector<Inner*> freeInners;
+
+        // version protocol. ReadLock waits out a writer and fails if the node
+        // is obsolete; Validate fails if the node changed since ReadLock;
+        // Upgrade locks the node only if it is still at version.
+        static bool ReadLock(const Node* node, uint64_t& version);
+        static bool Validate(const Node* node, uint64_t version);
+        static bool Upgrade(Node* node, uint64_t version);
+        static void Lock(Node* node);
+        static void Unlock(Node* node);
+        static void UnlockObsolete(Node* node);
+
+        // first position whose key is not less than, or is greater than, value
+        size_t LowerBound(const std::atomic<T>* keys, size_t count, const T& value) const;
+        size_t UpperBound(const std::atomic<T>* keys, size_t count, const T& value) const;
+
+        // fresh nodes, recycled from the pools where possible
+        Leaf* NewLeaf();
+        Inner* NewInner();
+
+        // leaf that would hold value (the leftmost leaf for nullptr), with its version
+        const Leaf* FindLeaf(const T* value, uint64_t& version) const;
+
+        // locks parent and node at their versions and splits node. Does
+        // nothing if either changed; the caller restarts either way.
+        void SplitLocked(Inner* parent, uint64_t parentVersion, Node* node, uint64_t version);
+        Leaf* SplitLeaf(Leaf* leaf, T& separator);
+        Inner* SplitInner(Inner* inner, T& separator);
+
+        // adds separator and the child right of it to a locked, non-full parent
+        void InsertChild(Inner* parent, const T& separator, Node* child);
+
+        // swaps in a whole new tree, retiring the old one to the pools
+        void Replace(Node* newRoot, size_t newHeight, size_t newSize);
+
+        // calls visit(key) in order for each key from *from on (all keys for
+        // nullptr), until visit returns false
+        template <typename Visit>
+        void Scan(const T* from, Visit visit) const;
+
+        static void FreeTree(Node* node);
+
+    public:
+        // default constructor
+        BPlusTree() : root(new Leaf()), height(1), size(0) {}
+
+        // destructor
+        virtual ~BPlusTree();
+
+        // trees are not copyable
+        BPlusTree(const BPlusTree&) = delete;
+        BPlusTree& operator=(const BPlusTree&) = delete;
+
+        // IDataStructure members
+        virtual bool Search(const T& value) override;
+        virtual void Print() override;
+        virtual bool Remove(const T& value) override;
+        virtual void Clear() override;
+        virtual size_t Size() override;
+
+        // ITree members. Insert returns false if value is already present.
+        virtual bool Insert(const T& value) override;
+        virtual size_t Height() override;
+        virtual size_t RangeQuery(const T& low, const T& high, std::vector<T>& out) override;
+
+        // replaces the contents with [first, last) in O(n). False, leaving
+        // the tree unchanged, unless the input is strictly increasing.
+        template <typename ForwardIt>
+        bool BulkLoad(ForwardIt first, ForwardIt last);
+    };
+} // namespace CDS
+
+#include <libcds/BPlusTree.tpp>
+
+#endif // CDS_BPLUSTREE_HPP
@@ -0,0 +1,657 @@
+// =================================================================
+// BPlusTree.tpp
+//  Description     Template Implementation of BPlusTree
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <algorithm>
+#include <libcds/BPlusTree.hpp>
+#include <thread>
+
+// Destructor frees the tree and everything in the pools.
+template <typename T, typename Compare, size_t NodeLines>
+CDS::BPlusTree<T, Compare, NodeLines>::~BPlusTree()
+{
+    FreeTree(root.load());
+    for (Leaf* leaf : freeLeaves)
+        delete leaf;
+    for (Inner* inner : freeInners)
+        delete inner;
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+bool
+CDS::BPlusTree<T, Compare, NodeLines>::ReadLock(const Node* node, uint64_t& version)
+{
+    uint64_t current = node->version.load(std::memory_order_acquire);
+    while (current & Locked)
+    {
+        std::this_thread::yield();
+        current = node->version.load(std::memory_order_acquire);
+    }
+    version = current;
+    return (current & Obsolete) == 0;
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+bool
+CDS::BPlusTree<T, Compare, NodeLines>::Validate(const Node* node, uint64_t version)
+{
+    // keeps the reads being validated from moving past the version check
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return node->version.load(std::memory_order_relaxed) == version;
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+bool
+CDS::BPlusTree<T, Compare, NodeLines>::Upgrade(Node* node, uint64_t version)
+{
+    if (!node->version.compare_exchange_strong(version, version + Locked, std::memory_order_acquire))
+        return false;
+
+    // keeps the writes that follow from becoming visible before the lock
+    std::atomic_thread_fence(std::memory_order_release);
+    return true;
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+void
+CDS::BPlusTree<T, Compare, NodeLines>::Lock(Node* node)
+{
+    uint64_t version;
+    while (!ReadLock(node, version) || !Upgrade(node, version))
+        std::this_thread::yield();
+}
+
+// clears the lock bit, carrying into the write count
+template <typename T, typename Compare, size_t NodeLines>
+void
+CDS::BPlusTree<T, Compare, NodeLines>::Unlock(Node* node)
+{
+    node->version.fetch_add(Locked, std::memory_order_release);
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+void
+CDS::BPlusTree<T, Compare, NodeLines>::UnlockObsolete(Node* node)
+{
+    node->version.fetch_add(Locked + Obsolete, std::memory_order_release);
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+size_t
+CDS::BPlusTree<T, Compare, NodeLines>::LowerBound(const std::atomic<T>* keys, size_t count, const T& value) const
+{
+    size_t low = 0;
+    while (count > 0)
+    {
+        size_t half = count / 2;
+        if (comp(keys[low + half].load(std::memory_order_relaxed), value))
+        {
+            low += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+    return low;
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+size_t
+CDS::BPlusTree<T, Compare, NodeLines>::UpperBound(const std::atomic<T>* keys, size_t count, const T& value) const
+{
+    size_t low = 0;
+    while (count > 0)
+    {
+        size_t half = count / 2;
+        if (!comp(value, keys[low + half].load(std::memory_order_relaxed)))
+        {
+            low += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+    return low;
+}
+
+// A recycled node gets a new version before it is reset, so a reader still
+// holding its old version fails validation.
+template <typename T, typename Compare, size_t NodeLines>
+typename CDS::BPlusTree<T, Compare, NodeLines>::Leaf*
+CDS::BPlusTree<T, Compare, NodeLines>::NewLeaf()
+{
+    Leaf* leaf = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(poolMtx);
+        if (!freeLeaves.empty())
+        {
+            leaf = freeLeaves.back();
+            freeLeaves.pop_back();
+        }
+    }
+    if (!leaf)
+        return new Leaf();
+
+    uint64_t version = leaf->version.load(std::memory_order_relaxed);
+    leaf->version.store((version | (Locked | Obsolete)) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    leaf->count.store(0, std::memory_order_relaxed);
+    leaf->next.store(nullptr, std::memory_order_relaxed);
+    return leaf;
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+typename CDS::BPlusTree<T, Compare, NodeLines>::Inner*
+CDS::BPlusTree<T, Compare, NodeLines>::NewInner()
+{
+    Inner* inner = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(poolMtx);
+        if (!freeInners.empty())
+        {
+            inner = freeInners.back();
+            freeInners.pop_back();
+        }
+    }
+    if (!inner)
+        return new Inner();
+
+    uint64_t version = inner->version.load(std::memory_order_relaxed);
+    inner->version.store((version | (Locked | Obsolete)) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    inner->count.store(0, std::memory_order_relaxed);
+    return inner;
+}
+
+// Lock coupling: each child is read-locked before its parent is validated
+// again, so the child was still linked when the walk reached it.
+template <typename T, typename Compare, size_t NodeLines>
+const typename CDS::BPlusTree<T, Compare, NodeLines>::Leaf*
+CDS::BPlusTree<T, Compare, NodeLines>::FindLeaf(const T* value, uint64_t& version) const
+{
+    for (;;)
+    {
+        const Node* node = root.load(std::memory_order_acquire);
+        if (!ReadLock(node, version) || node != root.load(std::memory_order_acquire))
+            continue;
+
+        bool valid = true;
+        while (valid && !node->leaf)
+        {
+            const Inner* inner = static_cast<const Inner*>(node);
+            size_t count = std::min<size_t>(inner->count.load(std::memory_order_relaxed), InnerCapacity);
+            size_t pos = value ? UpperBound(inner->keys, count, *value) : 0;
+            const Node* child = inner->children[pos].load(std::memory_order_relaxed);
+
+            uint64_t childVersion = 0;
+            valid = Validate(inner, version) && ReadLock(child, childVersion) && Validate(inner, version);
+            node = child;
+            version = childVersion;
+        }
+        if (valid)
+            return static_cast<const Leaf*>(node);
+    }
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+void
+CDS::BPlusTree<T, Compare, NodeLines>::SplitLocked(Inner* parent, uint64_t parentVersion, Node* node, uint64_t version)
+{
+    if (parent && !Upgrade(parent, parentVersion))
+        return;
+    if (!Upgrade(node, version))
+    {
+        if (parent)
+            Unlock(parent);
+        return;
+    }
+
+    T separator;
+    Node* right;
+    if (node->leaf)
+        right = SplitLeaf(static_cast<Leaf*>(node), separator);
+    else
+        right = SplitInner(static_cast<Inner*>(node), separator);
+
+    if (parent)
+    {
+        InsertChild(parent, separator, right);
+    }
+    else
+    {
+        // node was the root, which only changes under its lock
+        Inner* newRoot = NewInner();
+        newRoot->keys[0].store(separator, std::memory_order_relaxed);
+        newRoot->children[0].store(node, std::memory_order_relaxed);
+        newRoot->children[1].store(right, std::memory_order_relaxed);
+        newRoot->count.store(1, std::memory_order_relaxed);
+        root.store(newRoot, std::memory_order_release);
+        height.fetch_add(1);
+    }
+
+    Unlock(node);
+    if (parent)
+        Unlock(parent);
+}
+
+// Moves the upper half into a new right sibling. The separator is the
+// sibling's first key.
+template <typename T, typename Compare, size_t NodeLines>
+typename CDS::BPlusTree<T, Compare, NodeLines>::Leaf*
+CDS::BPlusTree<T, Compare, NodeLines>::SplitLeaf(Leaf* leaf, T& separator)
+{
+    Leaf* right = NewLeaf();
+    size_t count = leaf->count.load(std::memory_order_relaxed);
+    size_t mid = count / 2;
+    for (size_t i = mid; i < count; ++i)
+        right->keys[i - mid].store(leaf->keys[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    right->count.store(static_cast<uint16_t>(count - mid), std::memory_order_relaxed);
+    right->next.store(leaf->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    leaf->next.store(right, std::memory_order_relaxed);
+    leaf->count.store(static_cast<uint16_t>(mid), std::memory_order_relaxed);
+    separator = right->keys[0].load(std::memory_order_relaxed);
+    return right;
+}
+
+// The middle key moves up as the separator, belonging to neither half.
+template <typename T, typename Compare, size_t NodeLines>
+typename CDS::BPlusTree<T, Compare, NodeLines>::Inner*
+CDS::BPlusTree<T, Compare, NodeLines>::SplitInner(Inner* inner, T& separator)
+{
+    Inner* right = NewInner();
+    size_t count = inner->count.load(std::memory_order_relaxed);
+    size_t mid = count / 2;
+    for (size_t i = mid + 1; i < count; ++i)
+        right->keys[i - mid - 1].store(inner->keys[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    for (size_t i = mid + 1; i <= count; ++i)
+        right->children[i - mid - 1].store(inner->children[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    right->count.store(static_cast<uint16_t>(count - mid - 1), std::memory_order_relaxed);
+
+    separator = inner->keys[mid].load(std::memory_order_relaxed);
+    inner->count.store(static_cast<uint16_t>(mid), std::memory_order_relaxed);
+    return right;
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+void
+CDS::BPlusTree<T, Compare, NodeLines>::InsertChild(Inner* parent, const T& separator, Node* child)
+{
+    size_t count = parent->count.load(std::memory_order_relaxed);
+    size_t pos = UpperBound(parent->keys, count, separator);
+    for (size_t i = count; i > pos; --i)
+    {
+        parent->keys[i].store(parent->keys[i - 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        parent->children[i + 1].store(parent->children[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    parent->keys[pos].store(separator, std::memory_order_relaxed);
+    parent->children[pos + 1].store(child, std::memory_order_relaxed);
+    parent->count.store(static_cast<uint16_t>(count + 1), std::memory_order_relaxed);
+}
+
+// Locks the whole old tree top-down, so no reader validates and no writer
+// finishes inside it once the new root is visible. Writers never wait on a
+// lock while holding one, so waiting here cannot deadlock.
+template <typename T, typename Compare, size_t NodeLines>
+void
+CDS::BPlusTree<T, Compare, NodeLines>::Replace(Node* newRoot, size_t newHeight, size_t newSize)
+{
+    std::lock_guard<std::mutex> guard(replaceMtx);
+
+    Node* top;
+    for (;;)
+    {
+        top = root.load(std::memory_order_acquire);
+        Lock(top);
+        if (top == root.load(std::memory_order_acquire))
+            break;
+        Unlock(top);
+    }
+
+    std::vector<Node*> old(1, top);
+    for (size_t i = 0; i < old.size(); ++i)
+    {
+        if (old[i]->leaf)
+            continue;
+        Inner* inner = static_cast<Inner*>(old[i]);
+        size_t count = inner->count.load(std::memory_order_relaxed);
+        for (size_t c = 0; c <= count; ++c)
+        {
+            Node* child = inner->children[c].load(std::memory_order_relaxed);
+            Lock(child);
+            old.push_back(child);
+        }
+    }
+
+    size.store(newSize);
+    height.store(newHeight);
+    root.store(newRoot, std::memory_order_release);
+
+    for (Node* node : old)
+        UnlockObsolete(node);
+
+    std::lock_guard<std::mutex> lock(poolMtx);
+    for (Node* node : old)
+    {
+        if (node->leaf)
+            freeLeaves.push_back(static_cast<Leaf*>(node));
+        else
+            freeInners.push_back(static_cast<Inner*>(node));
+    }
+}
+
+// Copies each leaf out before validating it, then hands the keys to visit.
+// After a restart the walk resumes past the last key visited, so no key is
+// visited twice and keys always arrive in order.
+template <typename T, typename Compare, size_t NodeLines>
+template <typename Visit>
+void
+CDS::BPlusTree<T, Compare, NodeLines>::Scan(const T* from, Visit visit) const
+{
+    T bound = from ? *from : T();
+    bool bounded = from != nullptr;
+    bool inclusive = true;
+    T buffer[LeafCapacity];
+
+    for (;;)
+    {
+        uint64_t version;
+        const Leaf* leaf = FindLeaf(bounded ? &bound : nullptr, version);
+        for (;;)
+        {
+            size_t count = std::min<size_t>(leaf->count.load(std::memory_order_relaxed), LeafCapacity);
+            size_t pos = 0;
+            if (bounded)
+                pos = inclusive ? LowerBound(leaf->keys, count, bound) : UpperBound(leaf->keys, count, bound);
+
+            size_t copied = 0;
+            for (; pos < count; ++pos)
+                buffer[copied++] = leaf->keys[pos].load(std::memory_order_relaxed);
+            const Leaf* next = leaf->next.load(std::memory_order_relaxed);
+            if (!Validate(leaf, version))
+                break;
+
+            for (size_t i = 0; i < copied; ++i)
+            {
+                if (!visit(buffer[i]))
+                    return;
+            }
+            if (copied > 0)
+            {
+                bound = buffer[copied - 1];
+                bounded = true;
+                inclusive = false;
+            }
+            if (!next)
+                return;
+
+            uint64_t nextVersion;
+            if (!ReadLock(next, nextVersion) || !Validate(leaf, version))
+                break;
+            leaf = next;
+            version = nextVersion;
+        }
+    }
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+void
+CDS::BPlusTree<T, Compare, NodeLines>::FreeTree(Node* node)
+{
+    if (!node->leaf)
+    {
+        Inner* inner = static_cast<Inner*>(node);
+        size_t count = inner->count.load(std::memory_order_relaxed);
+        for (size_t i = 0; i <= count; ++i)
+            FreeTree(inner->children[i].load(std::memory_order_relaxed));
+        delete inner;
+    }
+    else
+    {
+        delete static_cast<Leaf*>(node);
+    }
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+bool
+CDS::BPlusTree<T, Compare, NodeLines>::Search(const T& value)
+{
+    for (;;)
+    {
+        uint64_t version;
+        const Leaf* leaf = FindLeaf(&value, version);
+        size_t count = std::min<size_t>(leaf->count.load(std::memory_order_relaxed), LeafCapacity);
+        size_t pos = LowerBound(leaf->keys, count, value);
+        bool found = pos < count && !comp(value, leaf->keys[pos].load(std::memory_order_relaxed));
+        if (Validate(leaf, version))
+            return found;
+    }
+}
+
+// prints the keys in order
+template <typename T, typename Compare, size_t NodeLines>
+void
+CDS::BPlusTree<T, Compare, NodeLines>::Print()
+{
+    Scan(nullptr,
+         [](const T& key)
+         {
+             std::cout << key << " ";
+             return true;
+         });
+    std::cout << std::endl;
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+bool
+CDS::BPlusTree<T, Compare, NodeLines>::Remove(const T& value)
+{
+    for (;;)
+    {
+        uint64_t version;
+        Leaf* leaf = const_cast<Leaf*>(FindLeaf(&value, version));
+        size_t count = std::min<size_t>(leaf->count.load(std::memory_order_relaxed), LeafCapacity);
+        size_t pos = LowerBound(leaf->keys, count, value);
+        bool found = pos < count && !comp(value, leaf->keys[pos].load(std::memory_order_relaxed));
+        if (!found)
+        {
+            if (Validate(leaf, version))
+                return false;
+            continue;
+        }
+        if (!Upgrade(leaf, version))
+            continue;
+
+        for (size_t i = pos + 1; i < count; ++i)
+            leaf->keys[i - 1].store(leaf->keys[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        leaf->count.store(static_cast<uint16_t>(count - 1), std::memory_order_relaxed);
+        size.fetch_sub(1);
+        Unlock(leaf);
+        return true;
+    }
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+void
+CDS::BPlusTree<T, Compare, NodeLines>::Clear()
+{
+    Replace(NewLeaf(), 1, 0);
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+size_t
+CDS::BPlusTree<T, Compare, NodeLines>::Size()
+{
+    return size.load();
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+bool
+CDS::BPlusTree<T, Compare, NodeLines>::Insert(const T& value)
+{
+    for (;;)
+    {
+        Node* node = root.load(std::memory_order_acquire);
+        uint64_t version;
+        if (!ReadLock(node, version) || node != root.load(std::memory_order_acquire))
+            continue;
+
+        Inner* parent = nullptr;
+        uint64_t parentVersion = 0;
+        bool restart = false;
+        while (!node->leaf)
+        {
+            Inner* inner = static_cast<Inner*>(node);
+            size_t count = std::min<size_t>(inner->count.load(std::memory_order_relaxed), InnerCapacity);
+
+            // split full inner nodes on the way down, so the parent of any
+            // split below has room for the new separator
+            if (count == InnerCapacity)
+            {
+                SplitLocked(parent, parentVersion, inner, version);
+                restart = true;
+                break;
+            }
+
+            size_t pos = UpperBound(inner->keys, count, value);
+            Node* child = inner->children[pos].load(std::memory_order_relaxed);
+            uint64_t childVersion;
+            if (!Validate(inner, version) || !ReadLock(child, childVersion) || !Validate(inner, version))
+            {
+                restart = true;
+                break;
+            }
+            parent = inner;
+            parentVersion = version;
+            node = child;
+            version = childVersion;
+        }
+        if (restart)
+            continue;
+
+        Leaf* leaf = static_cast<Leaf*>(node);
+        size_t count = std::min<size_t>(leaf->count.load(std::memory_order_relaxed), LeafCapacity);
+        size_t pos = LowerBound(leaf->keys, count, value);
+        if (pos < count && !comp(value, leaf->keys[pos].load(std::memory_order_relaxed)))
+        {
+            if (Validate(leaf, version))
+                return false;
+            continue;
+        }
+        if (count == LeafCapacity)
+        {
+            SplitLocked(parent, parentVersion, leaf, version);
+            continue;
+        }
+        if (!Upgrade(leaf, version))
+            continue;
+
+        for (size_t i = count; i > pos; --i)
+            leaf->keys[i].store(leaf->keys[i - 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        leaf->keys[pos].store(value, std::memory_order_relaxed);
+        leaf->count.store(static_cast<uint16_t>(count + 1), std::memory_order_relaxed);
+        size.fetch_add(1);
+        Unlock(leaf);
+        return true;
+    }
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+size_t
+CDS::BPlusTree<T, Compare, NodeLines>::Height()
+{
+    return height.load();
+}
+
+template <typename T, typename Compare, size_t NodeLines>
+size_t
+CDS::BPlusTree<T, Compare, NodeLines>::RangeQuery(const T& low, const T& high, std::vector<T>& out)
+{
+    size_t found = 0;
+    Scan(&low,
+         [&](const T& key)
+         {
+             if (comp(high, key))
+                 return false;
+             out.push_back(key);
+             found++;
+             return true;
+         });
+    return found;
+}
+
+// Builds the tree bottom-up: leaves are filled to three quarters, so inserts
+// after a load do not split at once, then each level of inner nodes is built
+// over the one below from each child's first key.
+template <typename T, typename Compare, size_t NodeLines>
+template <typename ForwardIt>
+bool
+CDS::BPlusTree<T, Compare, NodeLines>::BulkLoad(ForwardIt first, ForwardIt last)
+{
+    auto notIncreasing = [this](const T& a, const T& b) { return !comp(a, b); };
+    if (std::adjacent_find(first, last, notIncreasing) != last)
+        return false;
+
+    const size_t leafFill = LeafCapacity - LeafCapacity / 4;
+    const size_t innerFill = InnerCapacity - InnerCapacity / 4;
+
+    std::vector<Node*> level;
+    std::vector<T> lows;
+    size_t total = 0;
+    Leaf* previous = nullptr;
+    do
+    {
+        Leaf* leaf = NewLeaf();
+        size_t count = 0;
+        for (; first != last && count < leafFill; ++first)
+            leaf->keys[count++].store(*first, std::memory_order_relaxed);
+        leaf->count.store(static_cast<uint16_t>(count), std::memory_order_relaxed);
+        if (previous)
+            previous->next.store(leaf, std::memory_order_relaxed);
+        previous = leaf;
+        total += count;
+
+        level.push_back(leaf);
+        lows.push_back(count ? leaf->keys[0].load(std::memory_order_relaxed) : T());
+    } while (first != last);
+
+    size_t levels = 1;
+    while (level.size() > 1)
+    {
+        std::vector<Node*> parents;
+        std::vector<T> parentLows;
+        for (size_t i = 0; i < level.size();)
+        {
+            // never leave a single child for the last node
+            size_t take = std::min(innerFill + 1, level.size() - i);
+            if (level.size() - i - take == 1)
+                take--;
+
+            Inner* inner = NewInner();
+            inner->children[0].store(level[i], std::memory_order_relaxed);
+            for (size_t c = 1; c < take; ++c)
+            {
+                inner->keys[c - 1].store(lows[i + c], std::memory_order_relaxed);
+                inner->children[c].store(level[i + c], std::memory_order_relaxed);
+            }
+            inner->count.store(static_cast<uint16_t>(take - 1), std::memory_order_relaxed);
+
+            parents.push_back(inner);
+            parentLows.push_back(lows[i]);
+            i += take;
+        }
+        level.swap(parents);
+        lows.swap(parentLows);
+        levels++;
+    }
+
+    Replace(level[0], levels, total);
+    return true;
+}
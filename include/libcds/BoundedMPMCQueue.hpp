@@ -0,0 +1,109 @@
+// =================================================================
+// BoundedMPMCQueue.hpp
+//  Description     Declaration of BoundedMPMCQueue
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_BOUNDEDMPMCQUEUE_HPP
+#define CDS_BOUNDEDMPMCQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <libcds/DataStructure.hpp>
+#include <new>
+#include <util.hpp>
+
+namespace CDS
+{
+    /**
+     * BoundedMPMCQueue - Class to create a fixed-capacity FIFO queue for any
+     *  number of producers and consumers.
+     * Features:
+     *      Templated data type
+     *      Lock-free ring buffer, after Dmitry Vyukov's bounded MPMC queue
+     *      One CAS per Push or Pop, and one per batch in PushN/PopN
+     *      Producer and consumer counters on separate cache lines
+     *      Queue operations (push, pop, tryPop, pushN, popN)
+     *      Destructor
+     *
+     * Each cell carries a sequence number that says whose turn it is. A
+     * producer may fill cell pos once its sequence equals pos, and a consumer
+     * may empty it once its sequence equals pos + 1. Claiming a cell is a CAS
+     * on the shared counter, and handing it over is a store to the cell, so
+     * producers and consumers only meet on cells they actually share.
+     *
+     * TryPop reports empty while the oldest claimed cell is still being
+     * filled, even if a Push into a later cell has already returned.
+     *
+     * Note: Search, Print, and Remove walk the buffer directly, and are only
+     * safe while no other thread is using the queue.
+     */
+    template <typename T>
+    class BoundedMPMCQueue final : IDataStructure<T>
+    {
+        static_assert(CdsUtil::has_operator_equal<T>::value, "BoundedMPMCQueue requires T to have an == operator");
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T* Data() { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+
+        // read-only after construction
+        alignas(CacheLineSize) Cell* buffer;
+        size_t mask;
+
+        // each counter owns its cache line
+        alignas(CacheLineSize) std::atomic<size_t> enqueuePos;
+        alignas(CacheLineSize) std::atomic<size_t> dequeuePos;
+
+        // claims up to max consecutive cells for pushing or popping,
+        // returning how many were claimed from pos
+        size_t ClaimPush(size_t max, size_t& pos);
+        size_t ClaimPop(size_t max, size_t& pos);
+
+    public:
+        // default constructor. Capacity rounds up to a power of two.
+        explicit BoundedMPMCQueue(size_t capacity = 1024);
+
+        // destructor
+        virtual ~BoundedMPMCQueue();
+
+        BoundedMPMCQueue(const BoundedMPMCQueue&) = delete;
+        BoundedMPMCQueue& operator=(const BoundedMPMCQueue&) = delete;
+
+        // IDataStructure members
+        virtual bool Search(const T& value) override;
+        virtual void Print() override;
+        virtual bool Remove(const T& value) override;
+        virtual void Clear() override;
+        virtual size_t Size() override;
+
+        // queue members. Push waits while full, Pop waits while empty.
+        void Push(const T& value);
+        void Push(T&& value);
+        bool TryPush(const T& value);
+        bool TryPush(T&& value);
+        void Pop(T& out);
+        bool TryPop(T& out);
+
+        // pushes from [first, last) until full, popping up to max into out.
+        // Each takes one CAS. Both return how many elements moved.
+        template <typename ForwardIt>
+        size_t PushN(ForwardIt first, ForwardIt last);
+        template <typename OutputIt>
+        size_t PopN(OutputIt out, size_t max);
+
+        size_t Capacity() const { return mask + 1; }
+    };
+} // namespace CDS
+
+#include <libcds/BoundedMPMCQueue.tpp>
+
+#endif // CDS_BOUNDEDMPMCQUEUE_HPP
@@ -0,0 +1,272 @@
+// =================================================================
+// BoundedMPMCQueue.tpp
+//  Description     Template Implementation of BoundedMPMCQueue
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <libcds/BoundedMPMCQueue.hpp>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+template <typename T>
+CDS::BoundedMPMCQueue<T>::BoundedMPMCQueue(size_t capacity) : enqueuePos(0), dequeuePos(0)
+{
+    size_t rounded = 2;
+    while (rounded < capacity)
+        rounded <<= 1;
+
+    buffer = new Cell[rounded];
+    mask = rounded - 1;
+    for (size_t i = 0; i < rounded; ++i)
+        buffer[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+// Destructor destroys any elements left, then the buffer.
+template <typename T>
+CDS::BoundedMPMCQueue<T>::~BoundedMPMCQueue()
+{
+    Clear();
+    delete[] buffer;
+}
+
+// A cell is free for pos when its sequence is pos. Counts the run of free
+// cells from the current position, then claims them all with one CAS.
+template <typename T>
+size_t
+CDS::BoundedMPMCQueue<T>::ClaimPush(size_t max, size_t& pos)
+{
+    if (max == 0)
+        return 0;
+
+    pos = enqueuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        size_t count = 0;
+        while (count < max && count <= mask
+               && buffer[(pos + count) & mask].sequence.load(std::memory_order_acquire) == pos + count)
+            count++;
+
+        if (count == 0)
+        {
+            // full, unless another producer moved on since pos was read
+            size_t seq = buffer[pos & mask].sequence.load(std::memory_order_acquire);
+            if (static_cast<std::ptrdiff_t>(seq - pos) < 0)
+                return 0;
+            pos = enqueuePos.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (enqueuePos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+            return count;
+    }
+}
+
+// A cell holds an element for pos when its sequence is pos + 1.
+template <typename T>
+size_t
+CDS::BoundedMPMCQueue<T>::ClaimPop(size_t max, size_t& pos)
+{
+    if (max == 0)
+        return 0;
+
+    pos = dequeuePos.load(std::memory_order_relaxed);
+    while (true)
+    {
+        size_t count = 0;
+        while (count < max && count <= mask
+               && buffer[(pos + count) & mask].sequence.load(std::memory_order_acquire) == pos + count + 1)
+            count++;
+
+        if (count == 0)
+        {
+            // empty, unless another consumer moved on since pos was read
+            size_t seq = buffer[pos & mask].sequence.load(std::memory_order_acquire);
+            if (static_cast<std::ptrdiff_t>(seq - (pos + 1)) < 0)
+                return 0;
+            pos = dequeuePos.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (dequeuePos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+            return count;
+    }
+}
+
+template <typename T>
+bool
+CDS::BoundedMPMCQueue<T>::TryPush(const T& value)
+{
+    size_t pos;
+    if (ClaimPush(1, pos) == 0)
+        return false;
+
+    Cell& cell = buffer[pos & mask];
+    new (cell.storage) T(value);
+    cell.sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool
+CDS::BoundedMPMCQueue<T>::TryPush(T&& value)
+{
+    size_t pos;
+    if (ClaimPush(1, pos) == 0)
+        return false;
+
+    Cell& cell = buffer[pos & mask];
+    new (cell.storage) T(std::move(value));
+    cell.sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+void
+CDS::BoundedMPMCQueue<T>::Push(const T& value)
+{
+    while (!TryPush(value))
+        std::this_thread::yield();
+}
+
+template <typename T>
+void
+CDS::BoundedMPMCQueue<T>::Push(T&& value)
+{
+    while (!TryPush(std::move(value)))
+        std::this_thread::yield();
+}
+
+// Empties the cell, then marks it free for the producer one lap ahead.
+template <typename T>
+bool
+CDS::BoundedMPMCQueue<T>::TryPop(T& out)
+{
+    size_t pos;
+    if (ClaimPop(1, pos) == 0)
+        return false;
+
+    Cell& cell = buffer[pos & mask];
+    out = std::move(*cell.Data());
+    cell.Data()->~T();
+    cell.sequence.store(pos + mask + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+void
+CDS::BoundedMPMCQueue<T>::Pop(T& out)
+{
+    while (!TryPop(out))
+        std::this_thread::yield();
+}
+
+template <typename T>
+template <typename ForwardIt>
+size_t
+CDS::BoundedMPMCQueue<T>::PushN(ForwardIt first, ForwardIt last)
+{
+    size_t want = static_cast<size_t>(std::distance(first, last));
+    size_t pos;
+    size_t count = ClaimPush(want, pos);
+    for (size_t i = 0; i < count; ++i, ++first)
+    {
+        Cell& cell = buffer[(pos + i) & mask];
+        new (cell.storage) T(*first);
+        cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    return count;
+}
+
+template <typename T>
+template <typename OutputIt>
+size_t
+CDS::BoundedMPMCQueue<T>::PopN(OutputIt out, size_t max)
+{
+    size_t pos;
+    size_t count = ClaimPop(max, pos);
+    for (size_t i = 0; i < count; ++i)
+    {
+        Cell& cell = buffer[(pos + i) & mask];
+        *out++ = std::move(*cell.Data());
+        cell.Data()->~T();
+        cell.sequence.store(pos + i + mask + 1, std::memory_order_release);
+    }
+    return count;
+}
+
+// Searches for $value among the queued elements.
+template <typename T>
+bool
+CDS::BoundedMPMCQueue<T>::Search(const T& value)
+{
+    size_t end = enqueuePos.load();
+    for (size_t pos = dequeuePos.load(); pos != end; ++pos)
+    {
+        if (*buffer[pos & mask].Data() == value)
+            return true;
+    }
+    return false;
+}
+
+// prints the queue front to back, separated by spaces
+template <typename T>
+void
+CDS::BoundedMPMCQueue<T>::Print()
+{
+    size_t end = enqueuePos.load();
+    for (size_t pos = dequeuePos.load(); pos != end; ++pos)
+        std::cout << *buffer[pos & mask].Data() << " ";
+    std::cout << std::endl;
+}
+
+// removes the first instance of value, keeping the rest in order
+template <typename T>
+bool
+CDS::BoundedMPMCQueue<T>::Remove(const T& value)
+{
+    std::vector<T> kept;
+    while (PopN(std::back_inserter(kept), Capacity()) != 0)
+    {
+    }
+
+    bool found = false;
+    for (auto it = kept.begin(); it != kept.end(); ++it)
+    {
+        if (*it == value)
+        {
+            kept.erase(it);
+            found = true;
+            break;
+        }
+    }
+
+    PushN(std::make_move_iterator(kept.begin()), std::make_move_iterator(kept.end()));
+    return found;
+}
+
+// pops until the queue is observed empty
+template <typename T>
+void
+CDS::BoundedMPMCQueue<T>::Clear()
+{
+    size_t pos;
+    while (ClaimPop(1, pos) == 1)
+    {
+        Cell& cell = buffer[pos & mask];
+        cell.Data()->~T();
+        cell.sequence.store(pos + mask + 1, std::memory_order_release);
+    }
+}
+
+// approximate while other threads are pushing or popping
+template <typename T>
+size_t
+CDS::BoundedMPMCQueue<T>::Size()
+{
+    size_t head = dequeuePos.load();
+    size_t tail = enqueuePos.load();
+    return tail > head ? tail - head : 0;
+}
@@ -8,8 +8,16 @@
 #ifndef CDS_DATASTRUCTURE_HPP
 #define CDS_DATASTRUCTURE_HPP
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace CDS
 {
+    // assumed cache line size, used for node sizing and padding
+    constexpr size_t CacheLineSize = 64;
+
     /**
      * IDataStructure -- Abstract Interface featuring all base level
      *  virtual methods to be overridden by higher-level structures
@@ -38,7 +46,7 @@ namespace CDS
     {
     private:
         // also track base class
-        typedef IDataStructure BaseClass;
+        typedef IDataStructure<T> BaseClass;
 
     public:
         // constructor + destructor
@@ -60,25 +68,85 @@ namespace CDS
     };
 
     /**
-     * ITree -- Interface class for tree-style data structures
+     * ITree -- Interface class for ordered, tree-style data structures
      */
     template <typename T>
     class ITree : IDataStructure<T>
     {
     private:
         // track base class
-        typedef IDataStructure BaseClass;
-
-        // depth value
-        size_t depth;
+        typedef IDataStructure<T> BaseClass;
 
     public:
         // constructor + destructor
         ITree() {};
         virtual ~ITree() {};
 
-        // TODO: ITree members
+        // IDataStructure members
+        virtual bool Search(const T& value) override = 0;
+        virtual void Print() override = 0;
+        virtual bool Remove(const T& value) override = 0;
+        virtual void Clear() override = 0;
+        virtual size_t Size() override = 0;
+
+        // ITree members
+        virtual bool Insert(const T& value) = 0;
+        virtual size_t Height() = 0;
+
+        // appends every value in [low, high] to out in order, returning how many
+        virtual size_t RangeQuery(const T& low, const T& high, std::vector<T>& out) = 0;
     };
+
+    /**
+     * Static interface -- IsDataStructure and IsList hold when a type has the
+     *  members of IDataStructure or IList, checked at compile time. Every
+     *  concrete structure is final, so generic code written against these
+     *  traits (or the matching concepts) takes the concrete type and its
+     *  calls are resolved statically, with no vtable lookup.
+     */
+    template <typename D, typename T, typename = void>
+    struct IsDataStructure : std::false_type
+    {
+    };
+
+    template <typename D, typename T>
+    struct IsDataStructure<D, T,
+                           std::void_t<decltype(std::declval<D&>().Search(std::declval<const T&>())),
+                                       decltype(std::declval<D&>().Print()),
+                                       decltype(std::declval<D&>().Remove(std::declval<const T&>())),
+                                       decltype(std::declval<D&>().Clear()),
+                                       decltype(std::declval<D&>().Size())>>
+        : std::integral_constant<bool, std::is_convertible<decltype(std::declval<D&>().Search(std::declval<const T&>())), bool>::value
+                                           && std::is_convertible<decltype(std::declval<D&>().Remove(std::declval<const T&>())), bool>::value
+                                           && std::is_convertible<decltype(std::declval<D&>().Size()), size_t>::value>
+    {
+    };
+
+    template <typename L, typename T, typename = void>
+    struct IsList : std::false_type
+    {
+    };
+
+    template <typename L, typename T>
+    struct IsList<L, T,
+                  std::void_t<decltype(std::declval<L&>().IndexOf(std::declval<const T&>())),
+                              decltype(std::declval<L&>().Insert(std::declval<const T&>())),
+                              decltype(std::declval<L&>().Insert(std::declval<const T&>(), size_t())),
+                              decltype(std::declval<L&>().Get(size_t()))>>
+        : std::integral_constant<bool, IsDataStructure<L, T>::value
+                                           && std::is_convertible<decltype(std::declval<L&>().IndexOf(std::declval<const T&>())), size_t>::value
+                                           && std::is_convertible<decltype(std::declval<L&>().Insert(std::declval<const T&>())), bool>::value
+                                           && std::is_convertible<decltype(std::declval<L&>().Get(size_t())), T*>::value>
+    {
+    };
+
+#ifdef __cpp_concepts
+    template <typename D, typename T>
+    concept DataStructure = IsDataStructure<D, T>::value;
+
+    template <typename L, typename T>
+    concept List = IsList<L, T>::value;
+#endif
 } // namespace CDS
 
 #endif
@@ -9,9 +9,23 @@
 #define CDS_DOUBLYLINKED_HPP
 
 #include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <libcds/DataStructure.hpp>
+#include <libcds/IndexPolicy.hpp>
+#include <libcds/ListAlgorithms.hpp>
+#include <libcds/LockPolicy.hpp>
+#include <libcds/MappedListView.hpp>
+#include <libcds/NodePool.hpp>
+#include <libcds/Stats.hpp>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <type_traits>
+#include <util.hpp>
+#include <utility>
+#include <vector>
 
 namespace CDS
 {
@@ -19,13 +33,33 @@ namespace CDS
      * DoublyLinkedList - Class to create a doubly linked list.
      * Features:
      *      Templated data type
-     *      Thread safe using mutexes
+     *      Thread safe, with a pluggable locking policy (exclusive, shared, none)
+     *      Pluggable node allocator (e.g. NodePool)
      *      List operations (insert, indexOf, remove, print, etc.)
+     *      Move semantics and in-place construction (Emplace*)
+     *      Bulk operations (InsertRange, RemoveIf, RemoveAll, Append)
+     *      Bidirectional iterators, ForEach, Cursor, and cached Snapshot views
+     *      O(1) Get/Insert next to the last accessed index, walking from the nearer end otherwise
+     *      Pluggable value index (HashIndex) for O(1) Search/Remove by value
+     *      MoveToFront, PopFront, PopBack for LRU-style use
+     *      Stable Sort, Merge, and Unique, plus ParallelSort and ParallelFindAll
+     *      Save/Load to a binary file, which MappedListView can read in place
+     *      Opt-in statistics (CDS_ENABLE_STATS): op counts, lock waits, traversal lengths, allocations
      *      Destructor
+     *
+     * Iterators do not take the lock. Iterate under a Cursor, which holds a
+     * read lock for its lifetime, or over a list no other thread can see.
+     * Snapshot() copies the list once per modification and shares that copy
+     * between callers, so readers of a snapshot never block writers.
+     *
+     * With HashIndex, the index always points at the first node holding each
+     * value, so Remove and IndexOf keep their first-occurrence meaning.
      */
-    template <typename T>
-    class DoublyLinkedList : IList<T>
+    template <typename T, typename Allocator = std::allocator<T>, typename LockPolicy = ExclusiveLock, typename IndexPolicy = NoIndex>
+    class DoublyLinkedList final : IList<T>
     {
+        static_assert(CdsUtil::has_operator_equal<T>::value, "DoublyLinkedList requires T to have an == operator");
+
     private:
         struct Node
         {
@@ -33,27 +67,158 @@ namespace CDS
             Node* next;
             Node* prev;
 
-            Node(const T& value) : data(value), next(nullptr), prev(nullptr) {}
+            template <typename... Args>
+            explicit Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr), prev(nullptr)
+            {
+            }
         };
 
         Node* head;
         Node* tail;
-        size_t size;
-        mutable std::mutex mtx;
+        typename LockPolicy::template Counter<size_t> size;
+        // the list lock, counted when stats are compiled in
+        using Lock = StatsLock<LockPolicy>;
+        mutable typename Lock::Mutex mtx;
+
+        // bumped by every structural change, guarded by mtx
+        size_t version;
+
+        // last snapshot taken, and the version it was taken at
+        mutable std::mutex snapshotMtx;
+        mutable std::shared_ptr<const std::vector<T>> snapshot;
+        mutable size_t snapshotVersion;
+
+        // node of the last positional access, valid while lastVersion == version
+        mutable Node* lastNode;
+        mutable size_t lastIndex;
+        mutable size_t lastVersion;
+        mutable ReaderCacheMutex<LockPolicy> lastMtx;
+
+        // read-only members take ReadGuard, mutating members take WriteGuard
+        using ReadGuard = typename Lock::ReadGuard;
+        using WriteGuard = typename Lock::WriteGuard;
+
+        // nodes are allocated through Allocator, rebound to Node
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using NodeTraits = std::allocator_traits<NodeAllocator>;
+        NodeAllocator alloc;
+
+#ifdef CDS_ENABLE_STATS
+        // operation counters, summed by Stats()
+        mutable StripedCounters<StatCount> stats;
+
+        // where Stats() pushes each snapshot, if anywhere
+        StatsSink statsSink;
+#endif
+
+        // value to first node, maintained under the write lock
+        using IndexTable = typename IndexPolicy::template Table<T, Node>;
+        IndexTable valueIndex;
+
+        template <typename... Args>
+        Node* CreateNode(Args&&... args);
+        void DestroyNode(Node* node);
+        void DestroyAll();
+
+        template <typename... Args>
+        bool EmplaceLocked(size_t index, Args&&... args);
+
+        // finds the node at index < size, caching it for the next access
+        Node* Seek(size_t index) const;
+
+        // frees a detached chain of nodes
+        void DestroyChain(Node* chain);
+
+        // drops a node from the index and detaches it from its neighbors
+        void Unlink(Node* node);
+        void Detach(Node* node);
+
+        // rebuilds prev links, tail, and the index once the next links have
+        // been reordered. Caller must hold a WriteGuard.
+        void Relink();
+
+        // first node holding value, or nullptr
+        Node* FindNode(const T& value) const;
+
+        template <bool Const>
+        class Iterator
+        {
+        private:
+            friend class DoublyLinkedList;
+            using NodePtr = std::conditional_t<Const, const Node*, Node*>;
+            using ListPtr = std::conditional_t<Const, const DoublyLinkedList*, DoublyLinkedList*>;
+
+            ListPtr list;
+            NodePtr node;
+
+            Iterator(ListPtr list, NodePtr node) : list(list), node(node) {}
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T*, T*>;
+            using reference = std::conditional_t<Const, const T&, T&>;
+
+            Iterator() : list(nullptr), node(nullptr) {}
+
+            // iterator converts to const_iterator
+            operator Iterator<true>() const { return Iterator<true>(list, node); }
+
+            reference operator*() const { return node->data; }
+            pointer operator->() const { return &node->data; }
+
+            Iterator& operator++()
+            {
+                node = node->next;
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator temp = *this;
+                node = node->next;
+                return temp;
+            }
+
+            // decrementing end() lands on the tail
+            Iterator& operator--()
+            {
+                node = node ? node->prev : list->tail;
+                return *this;
+            }
+            Iterator operator--(int)
+            {
+                Iterator temp = *this;
+                --*this;
+                return temp;
+            }
+
+            bool operator==(const Iterator& other) const { return node == other.node; }
+            bool operator!=(const Iterator& other) const { return node != other.node; }
+        };
 
     public:
         // returned for not found in indexOf
         const size_t npos = static_cast<size_t>(-1);
 
-        // initialization list
-        DoublyLinkedList()
-            : head(nullptr), tail(nullptr), size(0)
+        // default constructor
+        DoublyLinkedList() : DoublyLinkedList(Allocator()) {}
+
+        // constructs with a specific allocator
+        explicit DoublyLinkedList(const Allocator& allocator)
+            : head(nullptr), tail(nullptr), size(0), version(0), snapshotVersion(0), lastNode(nullptr), lastIndex(0), lastVersion(0), alloc(allocator)
         {
         }
 
         // destructor definition
         virtual ~DoublyLinkedList();
 
+        // lists move in O(1), but are not copyable
+        DoublyLinkedList(DoublyLinkedList&& other);
+        DoublyLinkedList& operator=(DoublyLinkedList&& other);
+        DoublyLinkedList(const DoublyLinkedList&) = delete;
+        DoublyLinkedList& operator=(const DoublyLinkedList&) = delete;
+
         // IDataStructure members
         virtual bool Search(const T& value) override;
         virtual void Print() override;
@@ -66,6 +231,109 @@ namespace CDS
         virtual bool Insert(const T& value) override;
         virtual bool Insert(const T& value, size_t index) override;
         virtual T* Get(size_t index) override;
+
+        // move-aware insertion, constructing elements in place
+        bool Insert(T&& value);
+        bool Insert(T&& value, size_t index);
+        template <typename... Args>
+        bool Emplace(size_t index, Args&&... args);
+        template <typename... Args>
+        bool EmplaceFront(Args&&... args);
+        template <typename... Args>
+        bool EmplaceBack(Args&&... args);
+
+        // bulk operations, each taking the lock once
+        template <typename InputIt>
+        bool InsertRange(InputIt first, InputIt last, size_t index);
+        template <typename Pred>
+        size_t RemoveIf(Pred pred);
+        size_t RemoveAll(const T& value);
+        void Append(DoublyLinkedList&& other);
+
+        // ordering algorithms, each taking the lock once. Sort and Merge are
+        // stable and only relink nodes. Merge expects both lists sorted by
+        // comp, and leaves other empty. Unique drops each element equal to
+        // the one kept before it, returning the count.
+        template <typename Compare = std::less<T>>
+        void Sort(Compare comp = Compare());
+        template <typename Compare = std::less<T>>
+        void Merge(DoublyLinkedList&& other, Compare comp = Compare());
+        template <typename BinaryPred = std::equal_to<T>>
+        size_t Unique(BinaryPred pred = BinaryPred());
+
+        // parallel algorithms, splitting the list into a sublist per thread
+        // of pool. comp and pred must be safe to call from several threads.
+        template <typename Compare = std::less<T>>
+        void ParallelSort(Compare comp = Compare(), ThreadPool& pool = ThreadPool::Default());
+        template <typename Pred>
+        std::vector<T> ParallelFindAll(Pred pred, ThreadPool& pool = ThreadPool::Default()) const;
+
+        // moves the first node holding value to the front. False if absent.
+        bool MoveToFront(const T& value);
+
+        // removes the first or last element into out. False if empty.
+        bool PopFront(T& out);
+        bool PopBack(T& out);
+
+        // iteration. None of these take the lock.
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        // Cursor - read lock held for a whole traversal. The list must not be
+        // modified through its own members while a Cursor is open.
+        class Cursor
+        {
+        private:
+            friend class DoublyLinkedList;
+
+            const DoublyLinkedList& list;
+            ReadGuard lock;
+
+            explicit Cursor(const DoublyLinkedList& list) : list(list), lock(list.mtx) {}
+
+        public:
+            Cursor(const Cursor&) = delete;
+            Cursor& operator=(const Cursor&) = delete;
+
+            const_iterator begin() const { return list.begin(); }
+            const_iterator end() const { return list.end(); }
+            size_t Size() const { return list.size; }
+        };
+
+        // opens a Cursor; use as `auto cursor = list.OpenCursor();`
+        Cursor OpenCursor() const;
+
+        // calls fn(const T&) on each element in order, under one read lock
+        template <typename Fn>
+        void ForEach(Fn fn) const;
+
+        // immutable copy of the list, rebuilt only after the list changes
+        std::shared_ptr<const std::vector<T>> Snapshot() const;
+
+        // Save writes the list to path under one read lock, in the format
+        // MappedListView reads. Load replaces the contents with a saved list,
+        // leaving them unchanged if the file can't be read. S is the element
+        // Serializer, needed for types that are not trivially copyable.
+        template <typename S = Serializer<T>>
+        bool Save(const std::string& path) const;
+        template <typename S = Serializer<T>>
+        bool Load(const std::string& path);
+
+        // counters since construction or the last ResetStats. All zero
+        // unless built with CDS_ENABLE_STATS.
+        ListStats Stats() const;
+        void ResetStats();
+
+        // hands every Stats() snapshot to sink(name, stats), including the
+        // totals ResetStats is about to zero. A moved-to list starts with no
+        // sink. Does nothing unless built with CDS_ENABLE_STATS.
+        void SetStatsSink(std::string name, StatsSinkFn sink);
     };
 } // namespace CDS
 
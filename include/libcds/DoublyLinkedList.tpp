@@ -6,52 +6,245 @@
 // =================================================================
 
 #include <libcds/DoublyLinkedList.hpp>
+#include <utility>
 
 // Destructor deletes each node in the list.
-template <typename T>
-CDS::DoublyLinkedList<T>::~DoublyLinkedList()
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::~DoublyLinkedList()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    WriteGuard lock(mtx);
+    DestroyAll();
+    size = 0;
+}
+
+// Move constructor steals other's nodes in O(1). The allocator is copied, so
+// other keeps a usable one and a shared pool outlives either list.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::DoublyLinkedList(DoublyLinkedList&& other)
+    : head(nullptr), tail(nullptr), size(0), version(0), snapshotVersion(0), lastNode(nullptr), lastIndex(0), lastVersion(0), alloc(other.alloc)
+{
+    WriteGuard lock(other.mtx);
+    head = other.head;
+    other.head = nullptr;
+    tail = other.tail;
+    other.tail = nullptr;
+    size = static_cast<size_t>(other.size);
+    other.size = 0;
+    other.version++;
+    valueIndex = std::move(other.valueIndex);
+    other.valueIndex.OnClear();
+}
+
+// Move assignment frees this list's nodes, then steals other's. Nodes can
+// only change hands when both allocators can free them, otherwise the
+// elements are moved one at a time.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>&
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::operator=(DoublyLinkedList&& other)
+{
+    if (this == &other)
+        return *this;
+
+    std::scoped_lock lock(mtx, other.mtx);
+    DestroyAll();
+    size = 0;
+
+    if constexpr (NodeTraits::propagate_on_container_move_assignment::value)
+        alloc = other.alloc;
+
+    if (alloc == other.alloc)
+    {
+        head = other.head;
+        other.head = nullptr;
+        tail = other.tail;
+        other.tail = nullptr;
+        size = static_cast<size_t>(other.size);
+        valueIndex = std::move(other.valueIndex);
+        other.valueIndex.OnClear();
+    }
+    else
+    {
+        for (Node* current = other.head; current; current = current->next)
+            EmplaceLocked(size, std::move(current->data));
+        other.DestroyAll();
+    }
+    other.size = 0;
+    version++;
+    other.version++;
+    return *this;
+}
+
+// Allocates and constructs a node in place through the node allocator.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename... Args>
+typename CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Node*
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::CreateNode(Args&&... args)
+{
+    Node* node = NodeTraits::allocate(alloc, 1);
+    try
+    {
+        NodeTraits::construct(alloc, node, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        NodeTraits::deallocate(alloc, node, 1);
+        throw;
+    }
+    CDS_STAT(Allocations, 1);
+    return node;
+}
+
+// Destroys and frees a single node through the node allocator.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::DestroyNode(Node* node)
+{
+    NodeTraits::destroy(alloc, node);
+    NodeTraits::deallocate(alloc, node, 1);
+    CDS_STAT(Deallocations, 1);
+}
+
+// Frees every node. When nothing needs destructing and the allocator can drop
+// its whole arena, this is O(1) rather than a walk. Caller must hold a WriteGuard.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::DestroyAll()
+{
+    valueIndex.OnClear();
+    if constexpr (std::is_trivially_destructible<Node>::value && is_releasable_allocator<NodeAllocator>::value)
+    {
+        if (alloc.Release())
+        {
+            CDS_STAT(Deallocations, size);
+            head = nullptr;
+        }
+    }
+
     while (head)
     {
         Node* temp = head;
         head = head->next;
-        delete temp;
+        DestroyNode(temp);
     }
-    head = nullptr;
     tail = nullptr;
-    size = 0;
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Relink()
+{
+    if constexpr (IndexTable::Enabled)
+        valueIndex.OnClear();
+
+    Node* prev = nullptr;
+    for (Node* node = head; node; node = node->next)
+    {
+        node->prev = prev;
+        if constexpr (IndexTable::Enabled)
+            valueIndex.OnAppend(node);
+        prev = node;
+    }
+    tail = prev;
+}
+
+// Finds the node at index < size. Walks from head, tail, or the last accessed
+// node, whichever is nearest, so sequential access is O(1) per step. The last
+// access is only remembered when its lock is free, which can only fail under
+// SharedLock. Caller must hold a lock.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+typename CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Node*
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Seek(size_t index) const
+{
+    std::unique_lock<ReaderCacheMutex<LockPolicy>> lastLock(lastMtx, std::try_to_lock);
+
+    // start from whichever of head, tail, or the last node is nearest
+    Node* current = head;
+    size_t count = 0;
+    size_t distance = index;
+    if (size - 1 - index < distance)
+    {
+        current = tail;
+        count = size - 1;
+        distance = size - 1 - index;
+    }
+    if (lastLock.owns_lock() && lastNode && lastVersion == version)
+    {
+        size_t fromLast = lastIndex > index ? lastIndex - index : index - lastIndex;
+        if (fromLast < distance)
+        {
+            current = lastNode;
+            count = lastIndex;
+        }
+    }
+    CDS_STAT(Seeks, 1);
+    CDS_STAT(SeekSteps, count > index ? count - index : index - count);
+
+    // walk in whichever direction reaches index
+    while (count < index)
+    {
+        current = current->next;
+        count++;
+    }
+    while (count > index)
+    {
+        current = current->prev;
+        count--;
+    }
+
+    if (lastLock.owns_lock())
+    {
+        lastNode = current;
+        lastIndex = index;
+        lastVersion = version;
+    }
+    return current;
+}
+
+// First node holding value, or nullptr. O(1) with an index, otherwise a
+// scan. Caller must hold a lock.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+typename CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Node*
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::FindNode(const T& value) const
+{
+    CDS_STAT(Lookups, 1);
+    if constexpr (IndexTable::Enabled)
+        return valueIndex.Find(value);
+
+    Node* current = head;
+    size_t steps = 0;
+    while (current != nullptr && !(current->data == value))
+    {
+        current = current->next;
+        steps++;
+    }
+    CDS_STAT(LookupSteps, current ? steps + 1 : steps);
+    return current;
 }
 
 // Searches for $value in the list.
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
 bool
-CDS::DoublyLinkedList<T>::Search(const T& value)
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Search(const T& value)
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    ReadGuard lock(mtx);
+    CDS_STAT(Searches, 1);
 
     // check edge cases
     // ... list is empty
     if (head == nullptr || size == 0)
         return false;
 
-    // otherwise, traverse, return status.
-    Node* current = head;
-    while (current)
-    {
-        if (current->data == value)
-            return true;
-        current = current->next;
-    }
-    return false;
+    // otherwise, look it up, return status.
+    return FindNode(value) != nullptr;
 }
 
 // Retrieves value at index
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
 T*
-CDS::DoublyLinkedList<T>::Get(size_t index)
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Get(size_t index)
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    ReadGuard lock(mtx);
+    CDS_STAT(Gets, 1);
 
     // check edge cases
     // ... index out of range
@@ -62,27 +255,35 @@ CDS::DoublyLinkedList<T>::Get(size_t index)
         return nullptr;
 
     // otherwise, index is OK. traverse and retrieve
-    Node* current = head;
-    size_t count = 0;
-    while (count < index)
-    {
-        current = current->next;
-        count++;
-    }
-    return &current->data;
+    return &Seek(index)->data;
 }
 
 // Searches for value. If found, returns its index. If not found, returns npos.
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
 size_t
-CDS::DoublyLinkedList<T>::IndexOf(const T& value)
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::IndexOf(const T& value)
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    ReadGuard lock(mtx);
+    CDS_STAT(IndexOfs, 1);
 
     // handle edge case: list is empty
     if (head == nullptr || size == 0)
         return npos;
 
+    // with an index, misses are O(1) and hits count back to head
+    if constexpr (IndexTable::Enabled)
+    {
+        Node* found = valueIndex.Find(value);
+        if (found == nullptr)
+            return npos;
+
+        size_t index = 0;
+        for (Node* current = found->prev; current; current = current->prev)
+            index++;
+        CDS_STAT(IndexOfSteps, index + 1);
+        return index;
+    }
+
     // otherwise, count till its found and return.
     Node* current = head;
     size_t index = 0;
@@ -90,34 +291,88 @@ CDS::DoublyLinkedList<T>::IndexOf(const T& value)
     {
         if (current->data == value)
         {
+            CDS_STAT(IndexOfSteps, index + 1);
             return index;
         }
         current = current->next;
         index++;
     }
+    CDS_STAT(IndexOfSteps, index);
     return npos;
 }
 
 // inserts a value at index 0
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
 bool
-CDS::DoublyLinkedList<T>::Insert(const T& value)
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Insert(const T& value)
 {
     return Insert(value, 0);
 }
 
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Insert(const T& value, size_t index)
+{
+    return Emplace(index, value);
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Insert(T&& value)
+{
+    return Emplace(0, std::move(value));
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Insert(T&& value, size_t index)
+{
+    return Emplace(index, std::move(value));
+}
+
+// constructs the value in place at index, with no temporary copy
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename... Args>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Emplace(size_t index, Args&&... args)
+{
+    WriteGuard lock(mtx);
+    return EmplaceLocked(index, std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename... Args>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::EmplaceFront(Args&&... args)
+{
+    WriteGuard lock(mtx);
+    return EmplaceLocked(0, std::forward<Args>(args)...);
+}
+
+// appends at the end in O(1) through tail
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename... Args>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::EmplaceBack(Args&&... args)
+{
+    WriteGuard lock(mtx);
+    return EmplaceLocked(size, std::forward<Args>(args)...);
+}
+
+// performs the insertion. Caller must hold a WriteGuard.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename... Args>
 bool
-CDS::DoublyLinkedList<T>::Insert(const T& value, size_t index)
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::EmplaceLocked(size_t index, Args&&... args)
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    CDS_STAT(Inserts, 1);
 
     // Report failure if index > size
     if (index > size)
         return false;
 
     // Otherwise define the node.
-    Node* newNode = new Node(value);
+    Node* newNode = CreateNode(std::forward<Args>(args)...);
 
     // list is empty
     if (head == nullptr)
@@ -142,9 +397,7 @@ CDS::DoublyLinkedList<T>::Insert(const T& value, size_t index)
     else
     {
         // traverse to node just before insertion.
-        Node* current = head;
-        for (size_t i = 0; i < index - 1; ++i)
-            current = current->next;
+        Node* current = Seek(index - 1);
 
         // perform insertion
         newNode->next = current->next;
@@ -156,20 +409,31 @@ CDS::DoublyLinkedList<T>::Insert(const T& value, size_t index)
         current = nullptr;
     }
 
+    // insertion was successful. index, increment size & indicate success
+    valueIndex.OnInsert(newNode);
+    size++;
+    version++;
+
+    // sequential inserts continue from the new node
+    std::unique_lock<ReaderCacheMutex<LockPolicy>> lastLock(lastMtx, std::try_to_lock);
+    if (lastLock.owns_lock())
+    {
+        lastNode = newNode;
+        lastIndex = index;
+        lastVersion = version;
+    }
+
     // do not leave newNode dangling
     newNode = nullptr;
-
-    // insertion was successful. increment size & indicate success
-    size++;
     return true;
 }
 
 // prints the list, separated by spaces
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
 void
-CDS::DoublyLinkedList<T>::Print()
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Print()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    ReadGuard lock(mtx);
     Node* current = head;
     while (current)
     {
@@ -181,29 +445,52 @@ CDS::DoublyLinkedList<T>::Print()
 
 // removes the specified value. This removes the first value found, not all
 // instances.
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
 bool
-CDS::DoublyLinkedList<T>::Remove(const T& value)
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Remove(const T& value)
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    WriteGuard lock(mtx);
+    CDS_STAT(Removes, 1);
 
     // handle edge case (list is empty)
     if (head == nullptr)
         return false;
 
     // otherwise, remove if possible.
-    // traverse to find the node
-    Node* current = head;
-    while (current != nullptr && current->data != value)
-        current = current->next;
+    // find the node
+    Node* current = FindNode(value);
+
+    // value was not found
+    if (current == nullptr)
+        return false;
+
+    // value is now found. unlink, delete, update size, and return
+    Unlink(current);
+    DestroyNode(current);
+    size--;
+    version++;
+    return true;
+}
 
-    // value is now found. handle removal
+// drops node from the index, then detaches it. Caller must hold a WriteGuard.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Unlink(Node* node)
+{
+    valueIndex.OnErase(node);
+    Detach(node);
+}
 
+// detaches node from its neighbors, fixing head & tail. Caller must hold a WriteGuard.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Detach(Node* node)
+{
     // if it's the head...
-    if (current == head)
+    if (node == head)
     {
         // head points to next node
-        head = current->next;
+        head = node->next;
 
         // if it's not nullptr, then its previous should be
         if (head != nullptr)
@@ -213,46 +500,555 @@ CDS::DoublyLinkedList<T>::Remove(const T& value)
             tail = nullptr;
     }
     // if it's the tail...
-    else if (current == tail)
+    else if (node == tail)
     {
         // move tail to previous
-        tail = current->prev;
+        tail = node->prev;
         if (tail != nullptr)
             tail->next = nullptr;
     }
     // or, it's just a middle node...
     else
     {
-        current->prev->next = current->next;
-        current->next->prev = current->prev;
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+}
+
+// Inserts [first, last) at index, in order. Nodes are allocated before the
+// lock is taken, then spliced in with one walk.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename InputIt>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::InsertRange(InputIt first, InputIt last, size_t index)
+{
+    // build the chain unlocked
+    Node* chainHead = nullptr;
+    Node* chainTail = nullptr;
+    size_t count = 0;
+    try
+    {
+        for (; first != last; ++first)
+        {
+            Node* node = CreateNode(*first);
+            if (chainTail)
+            {
+                chainTail->next = node;
+                node->prev = chainTail;
+            }
+            else
+            {
+                chainHead = node;
+            }
+            chainTail = node;
+            count++;
+        }
+    }
+    catch (...)
+    {
+        DestroyChain(chainHead);
+        throw;
+    }
+
+    WriteGuard lock(mtx);
+    CDS_STAT(Inserts, 1);
+
+    // Report failure if index > size
+    if (index > size)
+    {
+        DestroyChain(chainHead);
+        return false;
+    }
+    if (chainHead == nullptr)
+        return true;
+
+    // link the chain between the node before index and the node at index
+    Node* before = nullptr;
+    Node* after = head;
+    if (index == size)
+    {
+        before = tail;
+        after = nullptr;
+    }
+    else
+    {
+        if (index > 0)
+        {
+            before = Seek(index - 1);
+            after = before->next;
+        }
+    }
+
+    chainHead->prev = before;
+    chainTail->next = after;
+    if (before)
+        before->next = chainHead;
+    else
+        head = chainHead;
+    if (after)
+        after->prev = chainTail;
+    else
+        tail = chainTail;
+
+    if constexpr (IndexTable::Enabled)
+    {
+        for (Node* node = chainHead; node != after; node = node->next)
+            valueIndex.OnInsert(node);
+    }
+
+    size = size + count;
+    version++;
+    return true;
+}
+
+// Removes every element for which pred holds, in one pass. Returns the count.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename Pred>
+size_t
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::RemoveIf(Pred pred)
+{
+    // unlink every match into a private chain, then free it unlocked
+    Node* garbage = nullptr;
+    size_t removed = 0;
+    {
+        WriteGuard lock(mtx);
+        CDS_STAT(Removes, 1);
+        Node* current = head;
+        while (current)
+        {
+            Node* next = current->next;
+            if (pred(current->data))
+            {
+                Unlink(current);
+                current->next = garbage;
+                garbage = current;
+                removed++;
+            }
+            current = next;
+        }
+        size = size - removed;
+        if (removed)
+            version++;
     }
 
-    // delete, update size, and return
-    delete current;
+    DestroyChain(garbage);
+    return removed;
+}
+
+// Removes every instance of value. Returns the count.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+size_t
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::RemoveAll(const T& value)
+{
+    return RemoveIf([&value](const T& data) { return data == value; });
+}
+
+// Moves all of other's elements onto the end of this list, leaving other
+// empty. Nodes are spliced when both allocators can free them.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Append(DoublyLinkedList&& other)
+{
+    if (this == &other)
+        return;
+
+    std::scoped_lock lock(mtx, other.mtx);
+    if (alloc == other.alloc)
+    {
+        // splice in O(1) through tail, then index other's nodes behind ours
+        if (other.head)
+        {
+            if constexpr (IndexTable::Enabled)
+            {
+                for (Node* node = other.head; node; node = node->next)
+                    valueIndex.OnAppend(node);
+                other.valueIndex.OnClear();
+            }
+
+            if (tail)
+            {
+                tail->next = other.head;
+                other.head->prev = tail;
+            }
+            else
+            {
+                head = other.head;
+            }
+            tail = other.tail;
+        }
+        other.head = nullptr;
+        other.tail = nullptr;
+        size = size + static_cast<size_t>(other.size);
+    }
+    else
+    {
+        for (Node* current = other.head; current; current = current->next)
+            EmplaceLocked(size, std::move(current->data));
+        other.DestroyAll();
+    }
+    other.size = 0;
+    version++;
+    other.version++;
+}
+
+// Relinks the node at the front without touching the index, since the first
+// node holding a value stays first when moved ahead of the rest.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::MoveToFront(const T& value)
+{
+    WriteGuard lock(mtx);
+    Node* node = FindNode(value);
+    if (node == nullptr)
+        return false;
+    if (node == head)
+        return true;
+
+    Detach(node);
+    node->prev = nullptr;
+    node->next = head;
+    if (head)
+        head->prev = node;
+    else
+        tail = node;
+    head = node;
+    version++;
+    return true;
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::PopFront(T& out)
+{
+    WriteGuard lock(mtx);
+    CDS_STAT(Removes, 1);
+    if (head == nullptr)
+        return false;
+
+    Node* node = head;
+    Unlink(node);
+    out = std::move(node->data);
+    DestroyNode(node);
     size--;
+    version++;
     return true;
 }
 
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::PopBack(T& out)
+{
+    WriteGuard lock(mtx);
+    CDS_STAT(Removes, 1);
+    if (tail == nullptr)
+        return false;
+
+    Node* node = tail;
+    Unlink(node);
+    out = std::move(node->data);
+    DestroyNode(node);
+    size--;
+    version++;
+    return true;
+}
+
+// Sorts by comp with a bottom-up merge sort, relinking nodes in place.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename Compare>
 void
-CDS::DoublyLinkedList<T>::Clear()
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Sort(Compare comp)
 {
-    std::lock_guard<std::mutex> lock(mtx);
-    while (head)
+    WriteGuard lock(mtx);
+    head = SortChain(head, comp);
+    Relink();
+    version++;
+}
+
+// Merges other, sorted by comp, into this sorted list, leaving other empty.
+// Among equal elements ours come first. Nodes are spliced when both
+// allocators can free them, otherwise the elements are moved.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename Compare>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Merge(DoublyLinkedList&& other, Compare comp)
+{
+    if (this == &other)
+        return;
+
+    std::scoped_lock lock(mtx, other.mtx);
+    Node* theirs = other.head;
+    size_t count = other.size;
+    if (alloc == other.alloc)
     {
-        Node* temp = head;
-        head = head->next;
-        delete temp;
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.valueIndex.OnClear();
     }
-    head = nullptr;
-    tail = nullptr;
+    else
+    {
+        theirs = nullptr;
+        Node** link = &theirs;
+        try
+        {
+            for (Node* current = other.head; current; current = current->next)
+            {
+                *link = CreateNode(std::move(current->data));
+                link = &(*link)->next;
+            }
+        }
+        catch (...)
+        {
+            DestroyChain(theirs);
+            throw;
+        }
+        other.DestroyAll();
+    }
+
+    head = MergeChains(head, theirs, comp);
+    Relink();
+    size = size + count;
+    other.size = 0;
+    version++;
+    other.version++;
+}
+
+// Removes each element for which pred(kept, element) holds, kept being the
+// last element not removed, in one pass. Returns the count.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename BinaryPred>
+size_t
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Unique(BinaryPred pred)
+{
+    // unlink every duplicate into a private chain, then free it unlocked
+    Node* garbage = nullptr;
+    size_t removed = 0;
+    {
+        WriteGuard lock(mtx);
+        Node* current = head;
+        while (current && current->next)
+        {
+            Node* next = current->next;
+            if (pred(current->data, next->data))
+            {
+                Unlink(next);
+                next->next = garbage;
+                garbage = next;
+                removed++;
+            }
+            else
+            {
+                current = next;
+            }
+        }
+        size = size - removed;
+        if (removed)
+            version++;
+    }
+
+    DestroyChain(garbage);
+    return removed;
+}
+
+// Sorts a sublist per thread of pool, then merges them, under the write lock.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename Compare>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::ParallelSort(Compare comp, ThreadPool& pool)
+{
+    WriteGuard lock(mtx);
+    head = ParallelSortChain(head, size, comp, pool);
+    Relink();
+    version++;
+}
+
+// Copies of every element for which pred holds, in list order, tested by a
+// sublist per thread of pool under the read lock.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename Pred>
+std::vector<T>
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::ParallelFindAll(Pred pred, ThreadPool& pool) const
+{
+    ReadGuard lock(mtx);
+    return ParallelFindAllChain<T>(head, size, pred, pool);
+}
+
+// Frees a detached chain linked through next.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::DestroyChain(Node* chain)
+{
+    while (chain)
+    {
+        Node* temp = chain;
+        chain = chain->next;
+        DestroyNode(temp);
+    }
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Clear()
+{
+    WriteGuard lock(mtx);
+    CDS_STAT(Clears, 1);
+    DestroyAll();
     size = 0;
+    version++;
+}
+
+// iterators start at head; end is one past the last node
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+typename CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::iterator
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::begin()
+{
+    return iterator(this, head);
 }
 
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+typename CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::iterator
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::end()
+{
+    return iterator(this, nullptr);
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+typename CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::const_iterator
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::begin() const
+{
+    return const_iterator(this, head);
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+typename CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::const_iterator
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::end() const
+{
+    return const_iterator(this, nullptr);
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+typename CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::const_iterator
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::cbegin() const
+{
+    return const_iterator(this, head);
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+typename CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::const_iterator
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::cend() const
+{
+    return const_iterator(this, nullptr);
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+typename CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Cursor
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::OpenCursor() const
+{
+    return Cursor(*this);
+}
+
+// visits every element in order under one read lock
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename Fn>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::ForEach(Fn fn) const
+{
+    ReadGuard lock(mtx);
+    for (Node* current = head; current; current = current->next)
+        fn(static_cast<const T&>(current->data));
+}
+
+// Copies the list under the read lock. The copy is cached and handed to every
+// caller until the next modification, so repeated snapshots of a quiet list
+// cost no walk.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+std::shared_ptr<const std::vector<T>>
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Snapshot() const
+{
+    ReadGuard lock(mtx);
+    std::lock_guard<std::mutex> cacheLock(snapshotMtx);
+    if (snapshot && snapshotVersion == version)
+        return snapshot;
+
+    auto copy = std::make_shared<std::vector<T>>();
+    copy->reserve(size);
+    for (Node* current = head; current; current = current->next)
+        copy->push_back(current->data);
+
+    snapshot = std::move(copy);
+    snapshotVersion = version;
+    return snapshot;
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename S>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Save(const std::string& path) const
+{
+    auto cursor = OpenCursor();
+    return WriteListFile<S>(path, cursor.begin(), cursor.end(), cursor.Size());
+}
+
+// Builds the new list aside, from the mapped file, and moves it in. With
+// the same allocator the move just takes the nodes.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+template <typename S>
+bool
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Load(const std::string& path)
+{
+    MappedListView<T, S> view;
+    if (!view.Open(path))
+        return false;
+
+    DoublyLinkedList loaded{Allocator(alloc)};
+    loaded.InsertRange(view.begin(), view.end(), 0);
+    *this = std::move(loaded);
+    return true;
+}
+
+// optimistic read: size is only written under the lock, and is read without it
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
 size_t
-CDS::DoublyLinkedList<T>::Size()
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Size()
 {
-    std::lock_guard<std::mutex> lock(mtx);
     return size;
 }
+
+// Sums the counters over every thread's stripe. Lock counters come from the
+// counted mutex, which is a plain mutex when stats are compiled out.
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+CDS::ListStats
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::Stats() const
+{
+    ListStats totals;
+#ifdef CDS_ENABLE_STATS
+    for (size_t i = 0; i < StatCount; ++i)
+        totals.values[i] = stats.Sum(i);
+    ReadLockStats(mtx, totals);
+    statsSink.Emit(totals);
+#endif
+    return totals;
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::ResetStats()
+{
+#ifdef CDS_ENABLE_STATS
+    // the sink sees the totals before they are zeroed
+    Stats();
+    stats.Reset();
+    ResetLockStats(mtx);
+#endif
+}
+
+template <typename T, typename Allocator, typename LockPolicy, typename IndexPolicy>
+void
+CDS::DoublyLinkedList<T, Allocator, LockPolicy, IndexPolicy>::SetStatsSink(std::string name, StatsSinkFn sink)
+{
+#ifdef CDS_ENABLE_STATS
+    statsSink.Set(std::move(name), std::move(sink));
+#else
+    (void)name;
+    (void)sink;
+#endif
+}
@@ -0,0 +1,124 @@
+// =================================================================
+// FineGrainedDoublyLinkedList.hpp
+//  Description     Declaration of FineGrainedDoublyLinkedList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_FINEGRAINEDDOUBLYLINKEDLIST_HPP
+#define CDS_FINEGRAINEDDOUBLYLINKEDLIST_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <libcds/DataStructure.hpp>
+#include <libcds/HazardPointer.hpp>
+#include <mutex>
+#include <util.hpp>
+
+namespace CDS
+{
+    /**
+     * FineGrainedDoublyLinkedList - Class to create a doubly linked list
+     *  with one mutex per node.
+     * Features:
+     *      Templated data type
+     *      Thread safe using hand-over-hand lock coupling
+     *      O(1) head and tail insertion, even while long scans are running
+     *      PopFront / PopBack for deque-style producer/consumer use
+     *      List operations (insert, indexOf, remove, print, etc.)
+     *      Destructor
+     *
+     * Locks are always taken front to back, so there is no deadlock. Head and
+     * tail are sentinels. A walk holds at most two node locks at once, so
+     * operations on different regions of the list run in parallel.
+     * Insert(value, 0) locks the head sentinel and the first node.
+     * Insert(value, Size()) locks the last node and the tail sentinel. The
+     * last node is found through tail.prev, which is read under a hazard
+     * pointer. Removed nodes are retired to that domain rather than deleted.
+     *
+     * Note: the pointer returned by Get() stays valid only until the element
+     * is removed by some thread.
+     */
+    template <typename T>
+    class FineGrainedDoublyLinkedList final : IList<T>
+    {
+        static_assert(CdsUtil::has_operator_equal<T>::value, "FineGrainedDoublyLinkedList requires T to have an == operator");
+
+    private:
+        // next is guarded by the owning link's mutex. prev is too, but is
+        // atomic because the tail path reads it before locking.
+        struct Link
+        {
+            Link* next;
+            std::atomic<Link*> prev;
+            bool removed;
+            std::mutex mtx;
+
+            Link() : next(nullptr), prev(nullptr), removed(false) {}
+        };
+
+        struct Node : Link
+        {
+            T data;
+
+            Node(const T& value) : data(value) {}
+        };
+
+        Link head;
+        Link tail;
+        std::atomic<size_t> size;
+
+        // walks hand-over-hand from head until stop(node, index) holds or the
+        // tail is reached. Returns with pred and cur both locked.
+        template <typename Stop>
+        void LockedWalk(Stop stop, Link*& pred, Link*& cur, size_t& index);
+
+        // links node between the locked pred and succ
+        void LinkBetween(Link* pred, Node* node, Link* succ);
+
+        // unlinks the locked cur from the locked pred and succ, then unlocks all three
+        void UnlinkAndRelease(Link* pred, Link* cur, Link* succ);
+
+        bool InsertFront(Node* node);
+        bool InsertBack(Node* node);
+
+        // unlinks the first element, moving it into out when given
+        bool RemoveFirst(T* out);
+
+    public:
+        // returned when index is not found for indexOf();
+        const size_t npos = static_cast<size_t>(-1);
+
+        // default constructor
+        FineGrainedDoublyLinkedList() : size(0)
+        {
+            head.next = &tail;
+            tail.prev.store(&head);
+        }
+
+        // destructor
+        virtual ~FineGrainedDoublyLinkedList();
+
+        // IDataStructure members
+        virtual bool Search(const T& value) override;
+        virtual void Print() override;
+        virtual bool Remove(const T& value) override;
+        virtual void Clear() override;
+        virtual size_t Size() override;
+
+        // IList members
+        virtual size_t IndexOf(const T& value) override;
+        virtual bool Insert(const T& value) override;
+        virtual bool Insert(const T& value, size_t index) override;
+        virtual T* Get(size_t index) override;
+
+        // removes the first or last element into out. False if empty.
+        bool PopFront(T& out);
+        bool PopBack(T& out);
+    };
+} // namespace CDS
+
+#include <libcds/FineGrainedDoublyLinkedList.tpp>
+
+#endif // CDS_FINEGRAINEDDOUBLYLINKEDLIST_HPP
@@ -0,0 +1,336 @@
+// =================================================================
+// FineGrainedDoublyLinkedList.tpp
+//  Description     Template Implementation of FineGrainedDoublyLinkedList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <libcds/FineGrainedDoublyLinkedList.hpp>
+#include <utility>
+
+// Destructor deletes each node still linked into the list.
+// Nodes already unlinked belong to the hazard pointer domain.
+template <typename T>
+CDS::FineGrainedDoublyLinkedList<T>::~FineGrainedDoublyLinkedList()
+{
+    Link* current = head.next;
+    while (current != &tail)
+    {
+        Link* temp = current;
+        current = current->next;
+        delete static_cast<Node*>(temp);
+    }
+}
+
+template <typename T>
+template <typename Stop>
+void
+CDS::FineGrainedDoublyLinkedList<T>::LockedWalk(Stop stop, Link*& pred, Link*& cur, size_t& index)
+{
+    pred = &head;
+    pred->mtx.lock();
+    cur = head.next;
+    cur->mtx.lock();
+    index = 0;
+
+    // lock the next link before letting go of the one behind us
+    while (cur != &tail && !stop(static_cast<Node*>(cur), index))
+    {
+        pred->mtx.unlock();
+        pred = cur;
+        cur = cur->next;
+        cur->mtx.lock();
+        index++;
+    }
+}
+
+template <typename T>
+void
+CDS::FineGrainedDoublyLinkedList<T>::LinkBetween(Link* pred, Node* node, Link* succ)
+{
+    node->next = succ;
+    node->prev.store(pred, std::memory_order_relaxed);
+    pred->next = node;
+    succ->prev.store(node);
+    size++;
+}
+
+template <typename T>
+void
+CDS::FineGrainedDoublyLinkedList<T>::UnlinkAndRelease(Link* pred, Link* cur, Link* succ)
+{
+    pred->next = succ;
+    succ->prev.store(pred);
+    cur->removed = true;
+    size--;
+
+    succ->mtx.unlock();
+    cur->mtx.unlock();
+    pred->mtx.unlock();
+
+    // a tail-side operation may still be about to lock cur
+    HazardPointers::Retire(static_cast<Node*>(cur));
+}
+
+// locks the head sentinel and the first link
+template <typename T>
+bool
+CDS::FineGrainedDoublyLinkedList<T>::InsertFront(Node* node)
+{
+    std::lock_guard<std::mutex> headLock(head.mtx);
+    Link* succ = head.next;
+    std::lock_guard<std::mutex> succLock(succ->mtx);
+    LinkBetween(&head, node, succ);
+    return true;
+}
+
+// locks the last link and the tail sentinel. The last link is found through
+// tail.prev, then validated once locked.
+template <typename T>
+bool
+CDS::FineGrainedDoublyLinkedList<T>::InsertBack(Node* node)
+{
+    while (true)
+    {
+        Link* pred = HazardPointers::Protect(0, tail.prev);
+        pred->mtx.lock();
+        if (pred->removed || pred->next != &tail)
+        {
+            pred->mtx.unlock();
+            continue;
+        }
+
+        tail.mtx.lock();
+        LinkBetween(pred, node, &tail);
+        tail.mtx.unlock();
+        pred->mtx.unlock();
+
+        HazardPointers::Clear(0);
+        return true;
+    }
+}
+
+template <typename T>
+bool
+CDS::FineGrainedDoublyLinkedList<T>::RemoveFirst(T* out)
+{
+    head.mtx.lock();
+    Link* cur = head.next;
+    if (cur == &tail)
+    {
+        head.mtx.unlock();
+        return false;
+    }
+
+    cur->mtx.lock();
+    Link* succ = cur->next;
+    succ->mtx.lock();
+    if (out)
+        *out = std::move(static_cast<Node*>(cur)->data);
+    UnlinkAndRelease(&head, cur, succ);
+    return true;
+}
+
+// Searches for $value in the list.
+template <typename T>
+bool
+CDS::FineGrainedDoublyLinkedList<T>::Search(const T& value)
+{
+    Link* pred;
+    Link* cur;
+    size_t index;
+    LockedWalk([&value](Node* node, size_t) { return node->data == value; }, pred, cur, index);
+
+    bool found = cur != &tail;
+    cur->mtx.unlock();
+    pred->mtx.unlock();
+    return found;
+}
+
+// Retrieves value at index
+template <typename T>
+T*
+CDS::FineGrainedDoublyLinkedList<T>::Get(size_t index)
+{
+    // check if index is in range
+    if (index >= size.load())
+        return nullptr;
+
+    Link* pred;
+    Link* cur;
+    size_t at;
+    LockedWalk([index](Node*, size_t i) { return i == index; }, pred, cur, at);
+
+    T* ret = cur != &tail ? &static_cast<Node*>(cur)->data : nullptr;
+    cur->mtx.unlock();
+    pred->mtx.unlock();
+    return ret;
+}
+
+// Searches for value. If found, returns its index. If not found, returns npos.
+template <typename T>
+size_t
+CDS::FineGrainedDoublyLinkedList<T>::IndexOf(const T& value)
+{
+    Link* pred;
+    Link* cur;
+    size_t index;
+    LockedWalk([&value](Node* node, size_t) { return node->data == value; }, pred, cur, index);
+
+    size_t ret = cur != &tail ? index : npos;
+    cur->mtx.unlock();
+    pred->mtx.unlock();
+    return ret;
+}
+
+// inserts a value at index 0
+template <typename T>
+bool
+CDS::FineGrainedDoublyLinkedList<T>::Insert(const T& value)
+{
+    return Insert(value, 0);
+}
+
+template <typename T>
+bool
+CDS::FineGrainedDoublyLinkedList<T>::Insert(const T& value, size_t index)
+{
+    // Report failure if index > size
+    size_t count = size.load();
+    if (index > count)
+        return false;
+
+    // head and tail get their O(1) paths
+    Node* newNode = new Node(value);
+    if (index == 0)
+        return InsertFront(newNode);
+    if (index == count)
+        return InsertBack(newNode);
+
+    // otherwise, walk to the insertion point
+    Link* pred;
+    Link* cur;
+    size_t at;
+    LockedWalk([index](Node*, size_t i) { return i == index; }, pred, cur, at);
+
+    // the list may have shrunk since size was read
+    bool ok = at == index;
+    if (ok)
+        LinkBetween(pred, newNode, cur);
+    cur->mtx.unlock();
+    pred->mtx.unlock();
+
+    if (!ok)
+        delete newNode;
+    return ok;
+}
+
+// prints the list, separated by spaces
+template <typename T>
+void
+CDS::FineGrainedDoublyLinkedList<T>::Print()
+{
+    Link* pred;
+    Link* cur;
+    size_t index;
+    LockedWalk(
+        [](Node* node, size_t)
+        {
+            std::cout << node->data << " ";
+            return false;
+        },
+        pred, cur, index);
+    cur->mtx.unlock();
+    pred->mtx.unlock();
+    std::cout << std::endl;
+}
+
+// removes the specified value. This removes the first value found, not all
+// instances.
+template <typename T>
+bool
+CDS::FineGrainedDoublyLinkedList<T>::Remove(const T& value)
+{
+    Link* pred;
+    Link* cur;
+    size_t index;
+    LockedWalk([&value](Node* node, size_t) { return node->data == value; }, pred, cur, index);
+
+    // value not found
+    if (cur == &tail)
+    {
+        cur->mtx.unlock();
+        pred->mtx.unlock();
+        return false;
+    }
+
+    Link* succ = cur->next;
+    succ->mtx.lock();
+    UnlinkAndRelease(pred, cur, succ);
+    return true;
+}
+
+template <typename T>
+bool
+CDS::FineGrainedDoublyLinkedList<T>::PopFront(T& out)
+{
+    return RemoveFirst(&out);
+}
+
+// locks the second-to-last link, the last link, and the tail sentinel
+template <typename T>
+bool
+CDS::FineGrainedDoublyLinkedList<T>::PopBack(T& out)
+{
+    while (true)
+    {
+        Link* victim = HazardPointers::Protect(0, tail.prev);
+        if (victim == &head)
+        {
+            HazardPointers::ClearAll();
+            return false;
+        }
+
+        // victim->prev is only safe to use while victim is still the last link
+        Link* pred = HazardPointers::Protect(1, victim->prev);
+        if (tail.prev.load() != victim)
+            continue;
+
+        pred->mtx.lock();
+        if (pred->removed || pred->next != victim)
+        {
+            pred->mtx.unlock();
+            continue;
+        }
+        victim->mtx.lock();
+        if (victim->next != &tail)
+        {
+            victim->mtx.unlock();
+            pred->mtx.unlock();
+            continue;
+        }
+        tail.mtx.lock();
+
+        out = std::move(static_cast<Node*>(victim)->data);
+        UnlinkAndRelease(pred, victim, &tail);
+        HazardPointers::ClearAll();
+        return true;
+    }
+}
+
+// removes from the front until the list is observed empty
+template <typename T>
+void
+CDS::FineGrainedDoublyLinkedList<T>::Clear()
+{
+    while (RemoveFirst(nullptr))
+    {
+    }
+}
+
+template <typename T>
+size_t
+CDS::FineGrainedDoublyLinkedList<T>::Size()
+{
+    return size.load();
+}
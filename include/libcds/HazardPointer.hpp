@@ -0,0 +1,100 @@
+// =================================================================
+// HazardPointer.hpp
+//  Description     Declaration of the hazard pointer reclamation domain
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_HAZARDPOINTER_HPP
+#define CDS_HAZARDPOINTER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace CDS
+{
+    /**
+     * HazardPointers - Process-wide hazard pointer domain used by the
+     *  lock-free structures for safe memory reclamation.
+     * Features:
+     *      A small, fixed number of hazard slots per thread
+     *      Per-thread retire lists, scanned once they grow past a threshold
+     *      Records of exited threads are recycled along with their retire lists
+     *
+     * A node is only freed once no thread has it published in a hazard slot,
+     * so a Remove() never frees memory another thread is still reading.
+     */
+    class HazardPointers
+    {
+    public:
+        // number of hazard slots each thread may use at once
+        static constexpr size_t SlotsPerThread = 3;
+
+        // retire list length that triggers a reclamation scan
+        static constexpr size_t ScanThreshold = 64;
+
+        // publishes p in this thread's hazard slot
+        static void Set(size_t slot, void* p);
+
+        // publishes the value of src in slot, re-reading until it is stable.
+        // Only suitable for sources that never carry mark bits.
+        template <typename P>
+        static P* Protect(size_t slot, const std::atomic<P*>& src);
+
+        // clears a single slot or every slot held by this thread
+        static void Clear(size_t slot);
+        static void ClearAll();
+
+        // hands p over for deletion once it is no longer hazardous
+        template <typename P>
+        static void Retire(P* p);
+        static void Retire(void* p, void (*deleter)(void*));
+
+        // frees every retired pointer of this thread that is not protected
+        static void Scan();
+
+    private:
+        struct Retired
+        {
+            void* ptr;
+            void (*deleter)(void*);
+        };
+
+        struct Record
+        {
+            std::atomic<void*> hazards[SlotsPerThread];
+            std::atomic<bool> active;
+            Record* next;
+            std::vector<Retired> retired;
+
+            Record() : active(true), next(nullptr)
+            {
+                for (size_t i = 0; i < SlotsPerThread; ++i)
+                    hazards[i].store(nullptr, std::memory_order_relaxed);
+            }
+        };
+
+        // owns every record, frees whatever is left at process exit
+        struct Registry
+        {
+            std::atomic<Record*> head{nullptr};
+            ~Registry();
+        };
+
+        // releases the thread's record when the thread exits
+        struct Owner
+        {
+            Record* record = nullptr;
+            ~Owner();
+        };
+
+        static Registry& GetRegistry();
+        static Record* Local();
+        static void Scan(Record* record);
+    };
+} // namespace CDS
+
+#include <libcds/HazardPointer.tpp>
+
+#endif // CDS_HAZARDPOINTER_HPP
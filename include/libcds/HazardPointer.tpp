@@ -0,0 +1,161 @@
+// =================================================================
+// HazardPointer.tpp
+//  Description     Implementation of the hazard pointer reclamation domain
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <algorithm>
+#include <libcds/HazardPointer.hpp>
+
+// Frees every record and any retired pointers left over at process exit.
+inline CDS::HazardPointers::Registry::~Registry()
+{
+    Record* current = head.load();
+    while (current)
+    {
+        Record* temp = current;
+        current = current->next;
+        for (Retired& r : temp->retired)
+            r.deleter(r.ptr);
+        delete temp;
+    }
+}
+
+// Drops this thread's hazards and hands its record back for reuse.
+inline CDS::HazardPointers::Owner::~Owner()
+{
+    if (record == nullptr)
+        return;
+    for (size_t i = 0; i < SlotsPerThread; ++i)
+        record->hazards[i].store(nullptr);
+    Scan(record);
+    record->active.store(false, std::memory_order_release);
+}
+
+inline CDS::HazardPointers::Registry&
+CDS::HazardPointers::GetRegistry()
+{
+    static Registry registry;
+    return registry;
+}
+
+// Retrieves the calling thread's record, claiming or allocating one on first use.
+inline CDS::HazardPointers::Record*
+CDS::HazardPointers::Local()
+{
+    static thread_local Owner owner;
+    if (owner.record)
+        return owner.record;
+
+    // first, try to recycle the record of a thread that has exited
+    Registry& registry = GetRegistry();
+    for (Record* r = registry.head.load(); r; r = r->next)
+    {
+        bool expected = false;
+        if (!r->active.load(std::memory_order_relaxed)
+            && r->active.compare_exchange_strong(expected, true))
+        {
+            owner.record = r;
+            return r;
+        }
+    }
+
+    // otherwise, push a new record onto the registry
+    Record* r = new Record();
+    Record* oldHead = registry.head.load();
+    do
+    {
+        r->next = oldHead;
+    } while (!registry.head.compare_exchange_weak(oldHead, r));
+
+    owner.record = r;
+    return r;
+}
+
+inline void
+CDS::HazardPointers::Set(size_t slot, void* p)
+{
+    Local()->hazards[slot].store(p);
+}
+
+template <typename P>
+P*
+CDS::HazardPointers::Protect(size_t slot, const std::atomic<P*>& src)
+{
+    std::atomic<void*>& hazard = Local()->hazards[slot];
+    P* p = src.load();
+    while (true)
+    {
+        hazard.store(p);
+        P* check = src.load();
+        if (check == p)
+            return p;
+        p = check;
+    }
+}
+
+inline void
+CDS::HazardPointers::Clear(size_t slot)
+{
+    Local()->hazards[slot].store(nullptr, std::memory_order_release);
+}
+
+inline void
+CDS::HazardPointers::ClearAll()
+{
+    Record* record = Local();
+    for (size_t i = 0; i < SlotsPerThread; ++i)
+        record->hazards[i].store(nullptr, std::memory_order_release);
+}
+
+template <typename P>
+void
+CDS::HazardPointers::Retire(P* p)
+{
+    Retire(static_cast<void*>(p), [](void* q) { delete static_cast<P*>(q); });
+}
+
+inline void
+CDS::HazardPointers::Retire(void* p, void (*deleter)(void*))
+{
+    Record* record = Local();
+    record->retired.push_back({p, deleter});
+    if (record->retired.size() >= ScanThreshold)
+        Scan(record);
+}
+
+inline void
+CDS::HazardPointers::Scan()
+{
+    Scan(Local());
+}
+
+// Frees every retired pointer of record that no thread currently protects.
+inline void
+CDS::HazardPointers::Scan(Record* record)
+{
+    // snapshot every published hazard
+    std::vector<void*> hazards;
+    for (Record* r = GetRegistry().head.load(); r; r = r->next)
+    {
+        for (size_t i = 0; i < SlotsPerThread; ++i)
+        {
+            void* p = r->hazards[i].load();
+            if (p)
+                hazards.push_back(p);
+        }
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    // free whatever is unprotected, keep the rest for a later scan
+    std::vector<Retired> keep;
+    for (Retired& r : record->retired)
+    {
+        if (std::binary_search(hazards.begin(), hazards.end(), r.ptr))
+            keep.push_back(r);
+        else
+            r.deleter(r.ptr);
+    }
+    record->retired.swap(keep);
+}
@@ -0,0 +1,128 @@
+// =================================================================
+// IndexPolicy.hpp
+//  Description     Declares the value index policies used by the lists
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_INDEXPOLICY_HPP
+#define CDS_INDEXPOLICY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <util.hpp>
+#include <vector>
+
+namespace CDS
+{
+    /**
+     * An index policy supplies a Table<T, Node> that a list keeps beside its
+     * nodes, mapping each value to the first node holding it. Node must have
+     * data, next, and prev members. The list calls the hooks while holding
+     * its write lock:
+     *      OnInsert(node)  after node is linked anywhere
+     *      OnAppend(node)  after node is linked behind every indexed node
+     *      OnErase(node)   before node is unlinked
+     *      OnClear()       when every node is dropped
+     * and calls Find(value) under either lock.
+     */
+
+    /**
+     * NoIndex -- no index at all. Every hook compiles away to nothing, and
+     *  the list falls back to scanning. This is the default.
+     */
+    struct NoIndex
+    {
+        template <typename T, typename Node>
+        struct Table
+        {
+            static constexpr bool Enabled = false;
+
+            void OnInsert(Node*) {}
+            void OnAppend(Node*) {}
+            void OnErase(Node*) {}
+            void OnClear() {}
+            Node* Find(const T&) const { return nullptr; }
+        };
+    };
+
+    /**
+     * HashTable - Open-addressed hash table from value to first node.
+     * Features:
+     *      Linear probing over one flat array of slots, kept at most half full
+     *      Backward-shift deletion, so there are no tombstones to skip
+     *      Cached hashes, so probes rarely dereference a node
+     *      Duplicate values share one slot, with a count
+     *
+     * Find is O(1) for any value. The first node for a value is kept exact:
+     * inserting a duplicate walks out from the new node in both directions
+     * until it meets the old first node or an end, which is O(1) at either
+     * end of the list. Erasing the first of several duplicates scans forward
+     * for the next one.
+     */
+    template <typename T, typename Node, typename Hash = std::hash<T>>
+    class HashTable
+    {
+        static_assert(CdsUtil::has_operator_equal<T>::value, "HashIndex requires T to have an == operator");
+        static_assert(CdsUtil::is_hashable<T>::value, "HashIndex requires std::hash<T>");
+
+    public:
+        static constexpr bool Enabled = true;
+
+        // slots allocated by the first insert
+        static constexpr size_t MinCapacity = 16;
+
+        HashTable() : used(0) {}
+
+        void OnInsert(Node* node);
+        void OnAppend(Node* node);
+        void OnErase(Node* node);
+        void OnClear();
+        Node* Find(const T& value) const;
+
+    private:
+        // an empty slot has no first node
+        struct Slot
+        {
+            Node* first;
+            size_t count;
+            size_t hash;
+        };
+
+        std::vector<Slot> slots;
+        size_t used;
+        Hash hasher;
+
+        size_t HashOf(const T& value) const;
+
+        // slot holding value, or the empty slot it would go in
+        size_t Probe(const T& value, size_t hash) const;
+
+        // adds node, returning whether its value was already present
+        bool Add(Node* node, size_t& slot);
+
+        // empties slot, shifting later probes back into the gap
+        void EraseSlot(size_t slot);
+
+        void Grow();
+
+        // whether node comes before other, both being in the same list
+        static bool Precedes(const Node* node, const Node* other);
+    };
+
+    /**
+     * HashIndex -- a HashTable from value to first node, so Search, Remove,
+     *  and IndexOf misses are O(1). T must have == and std::hash.
+     */
+    struct HashIndex
+    {
+        template <typename T, typename Node>
+        using Table = HashTable<T, Node>;
+    };
+} // namespace CDS
+
+#include <libcds/IndexPolicy.tpp>
+
+#endif // CDS_INDEXPOLICY_HPP
@@ -0,0 +1,171 @@
+// =================================================================
+// IndexPolicy.tpp
+//  Description     Template Implementation of the value index policies
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <libcds/IndexPolicy.hpp>
+
+// std::hash is often the identity for integers, so mix the bits before
+// masking off the low ones.
+template <typename T, typename Node, typename Hash>
+size_t
+CDS::HashTable<T, Node, Hash>::HashOf(const T& value) const
+{
+    uint64_t h = static_cast<uint64_t>(hasher(value));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+}
+
+template <typename T, typename Node, typename Hash>
+size_t
+CDS::HashTable<T, Node, Hash>::Probe(const T& value, size_t hash) const
+{
+    size_t mask = slots.size() - 1;
+    size_t i = hash & mask;
+    while (slots[i].first && !(slots[i].hash == hash && slots[i].first->data == value))
+        i = (i + 1) & mask;
+    return i;
+}
+
+template <typename T, typename Node, typename Hash>
+bool
+CDS::HashTable<T, Node, Hash>::Add(Node* node, size_t& slot)
+{
+    if ((used + 1) * 2 > slots.size())
+        Grow();
+
+    size_t hash = HashOf(node->data);
+    slot = Probe(node->data, hash);
+    if (slots[slot].first)
+    {
+        slots[slot].count++;
+        return true;
+    }
+
+    slots[slot] = Slot{node, 1, hash};
+    used++;
+    return false;
+}
+
+template <typename T, typename Node, typename Hash>
+void
+CDS::HashTable<T, Node, Hash>::OnInsert(Node* node)
+{
+    size_t slot;
+    if (Add(node, slot) && Precedes(node, slots[slot].first))
+        slots[slot].first = node;
+}
+
+template <typename T, typename Node, typename Hash>
+void
+CDS::HashTable<T, Node, Hash>::OnAppend(Node* node)
+{
+    size_t slot;
+    Add(node, slot);
+}
+
+template <typename T, typename Node, typename Hash>
+void
+CDS::HashTable<T, Node, Hash>::OnErase(Node* node)
+{
+    size_t slot = Probe(node->data, HashOf(node->data));
+    if (--slots[slot].count == 0)
+    {
+        EraseSlot(slot);
+        used--;
+        return;
+    }
+
+    // the next occurrence can only be further along
+    if (slots[slot].first == node)
+    {
+        Node* next = node->next;
+        while (!(next->data == node->data))
+            next = next->next;
+        slots[slot].first = next;
+    }
+}
+
+template <typename T, typename Node, typename Hash>
+void
+CDS::HashTable<T, Node, Hash>::OnClear()
+{
+    std::fill(slots.begin(), slots.end(), Slot{nullptr, 0, 0});
+    used = 0;
+}
+
+template <typename T, typename Node, typename Hash>
+Node*
+CDS::HashTable<T, Node, Hash>::Find(const T& value) const
+{
+    if (used == 0)
+        return nullptr;
+    return slots[Probe(value, HashOf(value))].first;
+}
+
+// A slot further along may move into the gap when the gap lies between its
+// home and where it sits now.
+template <typename T, typename Node, typename Hash>
+void
+CDS::HashTable<T, Node, Hash>::EraseSlot(size_t slot)
+{
+    size_t mask = slots.size() - 1;
+    size_t next = slot;
+    while (true)
+    {
+        next = (next + 1) & mask;
+        if (!slots[next].first)
+            break;
+
+        size_t home = slots[next].hash & mask;
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            slots[slot] = slots[next];
+            slot = next;
+        }
+    }
+    slots[slot] = Slot{nullptr, 0, 0};
+}
+
+template <typename T, typename Node, typename Hash>
+void
+CDS::HashTable<T, Node, Hash>::Grow()
+{
+    std::vector<Slot> old(std::max(MinCapacity, slots.size() * 2), Slot{nullptr, 0, 0});
+    old.swap(slots);
+
+    size_t mask = slots.size() - 1;
+    for (const Slot& s : old)
+    {
+        if (!s.first)
+            continue;
+        size_t i = s.hash & mask;
+        while (slots[i].first)
+            i = (i + 1) & mask;
+        slots[i] = s;
+    }
+}
+
+// Walks out from node in both directions at once. Meeting other ahead, or
+// the front of the list behind, means node is first. This costs the distance
+// to other or to the nearer end, whichever is shorter.
+template <typename T, typename Node, typename Hash>
+bool
+CDS::HashTable<T, Node, Hash>::Precedes(const Node* node, const Node* other)
+{
+    const Node* ahead = node->next;
+    const Node* behind = node->prev;
+    while (true)
+    {
+        if (ahead == other || behind == nullptr)
+            return true;
+        if (behind == other || ahead == nullptr)
+            return false;
+        ahead = ahead->next;
+        behind = behind->prev;
+    }
+}
@@ -0,0 +1,112 @@
+// =================================================================
+// IndexableSkipList.hpp
+//  Description     Declaration of IndexableSkipList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_INDEXABLESKIPLIST_HPP
+#define CDS_INDEXABLESKIPLIST_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <libcds/DataStructure.hpp>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <util.hpp>
+
+namespace CDS
+{
+    /**
+     * IndexableSkipList - Class to create a positional list over a skip list.
+     * Features:
+     *      Templated data type
+     *      Thread safe using mutexes
+     *      O(log n) expected Get, Insert, and RemoveAt at any index
+     *      List operations (insert, indexOf, remove, print, etc.)
+     *      Destructor
+     *
+     * Elements keep insertion order, not sorted order. Each link records how
+     * many elements it skips (its span), so a lookup by index descends the
+     * levels the same way a sorted skip list descends by key. Search, IndexOf,
+     * and Remove still scan, since values are unordered.
+     */
+    template <typename T>
+    class IndexableSkipList final : IList<T>
+    {
+        static_assert(CdsUtil::has_operator_equal<T>::value, "IndexableSkipList requires T to have an == operator");
+
+    public:
+        // levels a node may have. Enough for 4^32 elements.
+        static constexpr size_t MaxLevel = 32;
+
+    private:
+        struct Node;
+
+        // span is the number of elements next is ahead by, or 0 without a next
+        struct Level
+        {
+            Node* next;
+            size_t span;
+        };
+
+        struct Node
+        {
+            T data;
+            size_t height;
+            std::unique_ptr<Level[]> levels;
+
+            Node(const T& value, size_t height) : data(value), height(height), levels(new Level[height]) {}
+        };
+
+        Level head[MaxLevel];
+        size_t level;
+        size_t size;
+        std::minstd_rand rng;
+        mutable std::mutex mtx;
+
+        // height of a new node, each level kept with probability 1/4
+        size_t RandomHeight();
+
+        // node at index < size
+        Node* NodeAt(size_t index);
+
+        // fills update with the last link before index on each level, and
+        // rank with the position that link leaves from
+        void FindPredecessors(size_t index, Level** update, size_t* rank);
+
+        // unlinks and deletes the node at index < size
+        void EraseAt(size_t index);
+
+    public:
+        // returned when index is not found for indexOf();
+        const size_t npos = static_cast<size_t>(-1);
+
+        // default constructor
+        IndexableSkipList() : head(), level(0), size(0) {}
+
+        // destructor
+        virtual ~IndexableSkipList();
+
+        // IDataStructure members
+        virtual bool Search(const T& value) override;
+        virtual void Print() override;
+        virtual bool Remove(const T& value) override;
+        virtual void Clear() override;
+        virtual size_t Size() override;
+
+        // IList members
+        virtual size_t IndexOf(const T& value) override;
+        virtual bool Insert(const T& value) override;
+        virtual bool Insert(const T& value, size_t index) override;
+        virtual T* Get(size_t index) override;
+
+        // removes the element at index. False if out of range.
+        bool RemoveAt(size_t index);
+    };
+} // namespace CDS
+
+#include <libcds/IndexableSkipList.tpp>
+
+#endif // CDS_INDEXABLESKIPLIST_HPP
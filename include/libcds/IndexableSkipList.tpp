@@ -0,0 +1,261 @@
+// =================================================================
+// IndexableSkipList.tpp
+//  Description     Template Implementation of IndexableSkipList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <libcds/IndexableSkipList.hpp>
+
+// Destructor deletes each node in the list.
+template <typename T>
+CDS::IndexableSkipList<T>::~IndexableSkipList()
+{
+    Clear();
+}
+
+template <typename T>
+size_t
+CDS::IndexableSkipList<T>::RandomHeight()
+{
+    size_t height = 1;
+    while (height < MaxLevel && (rng() & 3) == 0)
+        height++;
+    return height;
+}
+
+// Descends from the top level, taking every link that does not overshoot.
+// Positions count from 1, with the head at 0.
+template <typename T>
+typename CDS::IndexableSkipList<T>::Node*
+CDS::IndexableSkipList<T>::NodeAt(size_t index)
+{
+    Level* links = head;
+    Node* node = nullptr;
+    size_t pos = 0;
+    for (size_t l = level; l-- > 0;)
+    {
+        while (links[l].next && pos + links[l].span <= index + 1)
+        {
+            pos += links[l].span;
+            node = links[l].next;
+            links = node->levels.get();
+        }
+    }
+    return node;
+}
+
+template <typename T>
+void
+CDS::IndexableSkipList<T>::FindPredecessors(size_t index, Level** update, size_t* rank)
+{
+    Level* links = head;
+    size_t pos = 0;
+    for (size_t l = level; l-- > 0;)
+    {
+        while (links[l].next && pos + links[l].span <= index)
+        {
+            pos += links[l].span;
+            links = links[l].next->levels.get();
+        }
+        update[l] = &links[l];
+        rank[l] = pos;
+    }
+}
+
+template <typename T>
+void
+CDS::IndexableSkipList<T>::EraseAt(size_t index)
+{
+    Level* update[MaxLevel] = {};
+    size_t rank[MaxLevel];
+    FindPredecessors(index, update, rank);
+
+    // links that jumped over the node now jump one less
+    Node* node = update[0]->next;
+    for (size_t l = 0; l < level; ++l)
+    {
+        if (update[l]->next == node)
+        {
+            update[l]->next = node->levels[l].next;
+            update[l]->span = update[l]->next ? update[l]->span + node->levels[l].span - 1 : 0;
+        }
+        else if (update[l]->next)
+        {
+            update[l]->span--;
+        }
+    }
+    delete node;
+
+    // drop levels that no longer hold anything
+    while (level > 0 && head[level - 1].next == nullptr)
+        level--;
+    size--;
+}
+
+// Searches for $value in the list.
+template <typename T>
+bool
+CDS::IndexableSkipList<T>::Search(const T& value)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    for (Node* current = head[0].next; current; current = current->levels[0].next)
+    {
+        if (current->data == value)
+            return true;
+    }
+    return false;
+}
+
+// Retrieves value at index
+template <typename T>
+T*
+CDS::IndexableSkipList<T>::Get(size_t index)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    // check if index is in range
+    if (index >= size)
+        return nullptr;
+
+    return &NodeAt(index)->data;
+}
+
+// Searches for value. If found, returns its index. If not found, returns npos.
+template <typename T>
+size_t
+CDS::IndexableSkipList<T>::IndexOf(const T& value)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t index = 0;
+    for (Node* current = head[0].next; current; current = current->levels[0].next)
+    {
+        if (current->data == value)
+            return index;
+        index++;
+    }
+    return npos;
+}
+
+// inserts a value at index 0
+template <typename T>
+bool
+CDS::IndexableSkipList<T>::Insert(const T& value)
+{
+    return Insert(value, 0);
+}
+
+template <typename T>
+bool
+CDS::IndexableSkipList<T>::Insert(const T& value, size_t index)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    // Report failure if index > size
+    if (index > size)
+        return false;
+
+    Level* update[MaxLevel] = {};
+    size_t rank[MaxLevel];
+    FindPredecessors(index, update, rank);
+
+    // new levels start out empty, from the head
+    size_t height = RandomHeight();
+    for (; level < height; ++level)
+    {
+        head[level] = Level{nullptr, 0};
+        update[level] = &head[level];
+        rank[level] = 0;
+    }
+
+    // split each link the node lands under
+    Node* node = new Node(value, height);
+    for (size_t l = 0; l < height; ++l)
+    {
+        Level& links = node->levels[l];
+        links.next = update[l]->next;
+        links.span = links.next ? update[l]->span - (index - rank[l]) : 0;
+        update[l]->next = node;
+        update[l]->span = index - rank[l] + 1;
+    }
+
+    // taller links now jump one more
+    for (size_t l = height; l < level; ++l)
+    {
+        if (update[l]->next)
+            update[l]->span++;
+    }
+
+    size++;
+    return true;
+}
+
+// prints the list, separated by spaces
+template <typename T>
+void
+CDS::IndexableSkipList<T>::Print()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    for (Node* current = head[0].next; current; current = current->levels[0].next)
+        std::cout << current->data << " ";
+    std::cout << std::endl;
+}
+
+// removes the specified value. This removes the first value found, not all
+// instances.
+template <typename T>
+bool
+CDS::IndexableSkipList<T>::Remove(const T& value)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t index = 0;
+    for (Node* current = head[0].next; current; current = current->levels[0].next)
+    {
+        if (current->data == value)
+        {
+            EraseAt(index);
+            return true;
+        }
+        index++;
+    }
+    return false;
+}
+
+template <typename T>
+bool
+CDS::IndexableSkipList<T>::RemoveAt(size_t index)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    if (index >= size)
+        return false;
+
+    EraseAt(index);
+    return true;
+}
+
+template <typename T>
+void
+CDS::IndexableSkipList<T>::Clear()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    Node* current = head[0].next;
+    while (current)
+    {
+        Node* temp = current;
+        current = current->levels[0].next;
+        delete temp;
+    }
+
+    for (size_t l = 0; l < level; ++l)
+        head[l] = Level{nullptr, 0};
+    level = 0;
+    size = 0;
+}
+
+template <typename T>
+size_t
+CDS::IndexableSkipList<T>::Size()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    return size;
+}
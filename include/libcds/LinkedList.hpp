@@ -9,9 +9,22 @@
 #define CDS_LINKEDLIST_HPP
 
 #include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <libcds/DataStructure.hpp>
+#include <libcds/ListAlgorithms.hpp>
+#include <libcds/LockPolicy.hpp>
+#include <libcds/MappedListView.hpp>
+#include <libcds/NodePool.hpp>
+#include <libcds/Stats.hpp>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <type_traits>
+#include <util.hpp>
+#include <utility>
+#include <vector>
 
 namespace CDS
 {
@@ -19,36 +32,155 @@ namespace CDS
      * LinkedList - Class to create a singly linked list.
      * Features:
      *      Templated data type
-     *      Thread safe using mutexes
+     *      Thread safe, with a pluggable locking policy (exclusive, shared, none)
+     *      Pluggable node allocator (e.g. NodePool)
      *      List operations (insert, indexOf, remove, print, etc.)
+     *      Move semantics and in-place construction (Emplace*)
+     *      Bulk operations (InsertRange, RemoveIf, RemoveAll, Append)
+     *      Forward iterators, ForEach, Cursor, and cached Snapshot views
+     *      O(1) Get/Insert next to the last accessed index
+     *      Stable Sort, Merge, and Unique, plus ParallelSort and ParallelFindAll
+     *      Save/Load to a binary file, which MappedListView can read in place
+     *      Opt-in statistics (CDS_ENABLE_STATS): op counts, lock waits, traversal lengths, allocations
      *      Destructor
+     *
+     * Iterators do not take the lock. Iterate under a Cursor, which holds a
+     * read lock for its lifetime, or over a list no other thread can see.
+     * Snapshot() copies the list once per modification and shares that copy
+     * between callers, so readers of a snapshot never block writers.
      */
-    template <typename T>
-    class LinkedList : IList<T>
+    template <typename T, typename Allocator = std::allocator<T>, typename LockPolicy = ExclusiveLock>
+    class LinkedList final : IList<T>
     {
+        static_assert(CdsUtil::has_operator_equal<T>::value, "LinkedList requires T to have an == operator");
+
     private:
         struct Node
         {
             T data;
             Node* next;
 
-            Node(const T& value) : data(value), next(nullptr) {}
+            template <typename... Args>
+            explicit Node(Args&&... args) : data(std::forward<Args>(args)...), next(nullptr)
+            {
+            }
         };
 
         Node* head;
-        size_t size;
-        mutable std::mutex mtx;
+        typename LockPolicy::template Counter<size_t> size;
+        // the list lock, counted when stats are compiled in
+        using Lock = StatsLock<LockPolicy>;
+        mutable typename Lock::Mutex mtx;
+
+        // bumped by every structural change, guarded by mtx
+        size_t version;
+
+        // last snapshot taken, and the version it was taken at
+        mutable std::mutex snapshotMtx;
+        mutable std::shared_ptr<const std::vector<T>> snapshot;
+        mutable size_t snapshotVersion;
+
+        // node of the last positional access, valid while lastVersion == version
+        mutable Node* lastNode;
+        mutable size_t lastIndex;
+        mutable size_t lastVersion;
+        mutable ReaderCacheMutex<LockPolicy> lastMtx;
+
+        // read-only members take ReadGuard, mutating members take WriteGuard
+        using ReadGuard = typename Lock::ReadGuard;
+        using WriteGuard = typename Lock::WriteGuard;
+
+        // nodes are allocated through Allocator, rebound to Node
+        using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using NodeTraits = std::allocator_traits<NodeAllocator>;
+        NodeAllocator alloc;
+
+#ifdef CDS_ENABLE_STATS
+        // operation counters, summed by Stats()
+        mutable StripedCounters<StatCount> stats;
+
+        // where Stats() pushes each snapshot, if anywhere
+        StatsSink statsSink;
+#endif
+
+        template <typename... Args>
+        Node* CreateNode(Args&&... args);
+        void DestroyNode(Node* node);
+        void DestroyAll();
+
+        template <typename... Args>
+        bool EmplaceLocked(size_t index, Args&&... args);
+
+        // finds the node at index < size, caching it for the next access
+        Node* Seek(size_t index) const;
+
+        // frees a detached chain of nodes
+        void DestroyChain(Node* chain);
+
+        template <bool Const>
+        class Iterator
+        {
+        private:
+            friend class LinkedList;
+            using NodePtr = std::conditional_t<Const, const Node*, Node*>;
+
+            NodePtr node;
+
+            explicit Iterator(NodePtr node) : node(node) {}
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<Const, const T*, T*>;
+            using reference = std::conditional_t<Const, const T&, T&>;
+
+            Iterator() : node(nullptr) {}
+
+            // iterator converts to const_iterator
+            operator Iterator<true>() const { return Iterator<true>(node); }
+
+            reference operator*() const { return node->data; }
+            pointer operator->() const { return &node->data; }
+
+            Iterator& operator++()
+            {
+                node = node->next;
+                return *this;
+            }
+            Iterator operator++(int)
+            {
+                Iterator temp = *this;
+                node = node->next;
+                return temp;
+            }
+
+            bool operator==(const Iterator& other) const { return node == other.node; }
+            bool operator!=(const Iterator& other) const { return node != other.node; }
+        };
 
     public:
         // returned when index is not found for indexOf();
         const size_t npos = static_cast<size_t>(-1);
 
         // default constructor
-        LinkedList() : head(nullptr), size(0) {}
+        LinkedList() : LinkedList(Allocator()) {}
+
+        // constructs with a specific allocator
+        explicit LinkedList(const Allocator& allocator)
+            : head(nullptr), size(0), version(0), snapshotVersion(0), lastNode(nullptr), lastIndex(0), lastVersion(0), alloc(allocator)
+        {
+        }
 
         // destructor
         virtual ~LinkedList();
 
+        // lists move in O(1), but are not copyable
+        LinkedList(LinkedList&& other);
+        LinkedList& operator=(LinkedList&& other);
+        LinkedList(const LinkedList&) = delete;
+        LinkedList& operator=(const LinkedList&) = delete;
+
         // IDataStructure members
         virtual bool Search(const T& value) override;
         virtual void Print() override;
@@ -61,6 +193,102 @@ namespace CDS
         virtual bool Insert(const T& value) override;
         virtual bool Insert(const T& value, size_t index) override;
         virtual T* Get(size_t index) override;
+
+        // move-aware insertion, constructing elements in place
+        bool Insert(T&& value);
+        bool Insert(T&& value, size_t index);
+        template <typename... Args>
+        bool Emplace(size_t index, Args&&... args);
+        template <typename... Args>
+        bool EmplaceFront(Args&&... args);
+        template <typename... Args>
+        bool EmplaceBack(Args&&... args);
+
+        // bulk operations, each taking the lock once
+        template <typename InputIt>
+        bool InsertRange(InputIt first, InputIt last, size_t index);
+        template <typename Pred>
+        size_t RemoveIf(Pred pred);
+        size_t RemoveAll(const T& value);
+        void Append(LinkedList&& other);
+
+        // ordering algorithms, each taking the lock once. Sort and Merge are
+        // stable and only relink nodes. Merge expects both lists sorted by
+        // comp, and leaves other empty. Unique drops each element equal to
+        // the one kept before it, returning the count.
+        template <typename Compare = std::less<T>>
+        void Sort(Compare comp = Compare());
+        template <typename Compare = std::less<T>>
+        void Merge(LinkedList&& other, Compare comp = Compare());
+        template <typename BinaryPred = std::equal_to<T>>
+        size_t Unique(BinaryPred pred = BinaryPred());
+
+        // parallel algorithms, splitting the list into a sublist per thread
+        // of pool. comp and pred must be safe to call from several threads.
+        template <typename Compare = std::less<T>>
+        void ParallelSort(Compare comp = Compare(), ThreadPool& pool = ThreadPool::Default());
+        template <typename Pred>
+        std::vector<T> ParallelFindAll(Pred pred, ThreadPool& pool = ThreadPool::Default()) const;
+
+        // iteration. None of these take the lock.
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+        // Cursor - read lock held for a whole traversal. The list must not be
+        // modified through its own members while a Cursor is open.
+        class Cursor
+        {
+        private:
+            friend class LinkedList;
+
+            const LinkedList& list;
+            ReadGuard lock;
+
+            explicit Cursor(const LinkedList& list) : list(list), lock(list.mtx) {}
+
+        public:
+            Cursor(const Cursor&) = delete;
+            Cursor& operator=(const Cursor&) = delete;
+
+            const_iterator begin() const { return list.begin(); }
+            const_iterator end() const { return list.end(); }
+            size_t Size() const { return list.size; }
+        };
+
+        // opens a Cursor; use as `auto cursor = list.OpenCursor();`
+        Cursor OpenCursor() const;
+
+        // calls fn(const T&) on each element in order, under one read lock
+        template <typename Fn>
+        void ForEach(Fn fn) const;
+
+        // immutable copy of the list, rebuilt only after the list changes
+        std::shared_ptr<const std::vector<T>> Snapshot() const;
+
+        // Save writes the list to path under one read lock, in the format
+        // MappedListView reads. Load replaces the contents with a saved list,
+        // leaving them unchanged if the file can't be read. S is the element
+        // Serializer, needed for types that are not trivially copyable.
+        template <typename S = Serializer<T>>
+        bool Save(const std::string& path) const;
+        template <typename S = Serializer<T>>
+        bool Load(const std::string& path);
+
+        // counters since construction or the last ResetStats. All zero
+        // unless built with CDS_ENABLE_STATS.
+        ListStats Stats() const;
+        void ResetStats();
+
+        // hands every Stats() snapshot to sink(name, stats), including the
+        // totals ResetStats is about to zero. A moved-to list starts with no
+        // sink. Does nothing unless built with CDS_ENABLE_STATS.
+        void SetStatsSink(std::string name, StatsSinkFn sink);
     };
 } // namespace CDS
 
@@ -6,43 +6,186 @@
 // =================================================================
 
 #include <libcds/LinkedList.hpp>
+#include <utility>
 
 // Destructor deletes each node in the list.
-template <typename T>
-CDS::LinkedList<T>::~LinkedList()
+template <typename T, typename Allocator, typename LockPolicy>
+CDS::LinkedList<T, Allocator, LockPolicy>::~LinkedList()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    WriteGuard lock(mtx);
+    DestroyAll();
+}
+
+// Move constructor steals other's nodes in O(1). The allocator is copied, so
+// other keeps a usable one and a shared pool outlives either list.
+template <typename T, typename Allocator, typename LockPolicy>
+CDS::LinkedList<T, Allocator, LockPolicy>::LinkedList(LinkedList&& other)
+    : head(nullptr), size(0), version(0), snapshotVersion(0), lastNode(nullptr), lastIndex(0), lastVersion(0), alloc(other.alloc)
+{
+    WriteGuard lock(other.mtx);
+    head = other.head;
+    other.head = nullptr;
+    size = static_cast<size_t>(other.size);
+    other.size = 0;
+    other.version++;
+}
+
+// Move assignment frees this list's nodes, then steals other's. Nodes can
+// only change hands when both allocators can free them, otherwise the
+// elements are moved one at a time.
+template <typename T, typename Allocator, typename LockPolicy>
+CDS::LinkedList<T, Allocator, LockPolicy>&
+CDS::LinkedList<T, Allocator, LockPolicy>::operator=(LinkedList&& other)
+{
+    if (this == &other)
+        return *this;
+
+    std::scoped_lock lock(mtx, other.mtx);
+    DestroyAll();
+    size = 0;
+
+    if constexpr (NodeTraits::propagate_on_container_move_assignment::value)
+        alloc = other.alloc;
+
+    if (alloc == other.alloc)
+    {
+        head = other.head;
+        other.head = nullptr;
+        size = static_cast<size_t>(other.size);
+    }
+    else
+    {
+        for (Node* current = other.head; current; current = current->next)
+            EmplaceLocked(size, std::move(current->data));
+        other.DestroyAll();
+    }
+    other.size = 0;
+    version++;
+    other.version++;
+    return *this;
+}
+
+// Allocates and constructs a node in place through the node allocator.
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename... Args>
+typename CDS::LinkedList<T, Allocator, LockPolicy>::Node*
+CDS::LinkedList<T, Allocator, LockPolicy>::CreateNode(Args&&... args)
+{
+    Node* node = NodeTraits::allocate(alloc, 1);
+    try
+    {
+        NodeTraits::construct(alloc, node, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        NodeTraits::deallocate(alloc, node, 1);
+        throw;
+    }
+    CDS_STAT(Allocations, 1);
+    return node;
+}
+
+// Destroys and frees a single node through the node allocator.
+template <typename T, typename Allocator, typename LockPolicy>
+void
+CDS::LinkedList<T, Allocator, LockPolicy>::DestroyNode(Node* node)
+{
+    NodeTraits::destroy(alloc, node);
+    NodeTraits::deallocate(alloc, node, 1);
+    CDS_STAT(Deallocations, 1);
+}
+
+// Frees every node. When nothing needs destructing and the allocator can drop
+// its whole arena, this is O(1) rather than a walk. Caller must hold a WriteGuard.
+template <typename T, typename Allocator, typename LockPolicy>
+void
+CDS::LinkedList<T, Allocator, LockPolicy>::DestroyAll()
+{
+    if constexpr (std::is_trivially_destructible<Node>::value && is_releasable_allocator<NodeAllocator>::value)
+    {
+        if (alloc.Release())
+        {
+            CDS_STAT(Deallocations, size);
+            head = nullptr;
+        }
+    }
+
     while (head)
     {
         Node* temp = head;
         head = head->next;
-        delete temp;
+        DestroyNode(temp);
     }
 }
 
+// Finds the node at index < size. Walks from the last accessed node when it
+// is not past index, so sequential access is O(1) per step. The last access
+// is only remembered when its lock is free, which can only fail under
+// SharedLock. Caller must hold a lock.
+template <typename T, typename Allocator, typename LockPolicy>
+typename CDS::LinkedList<T, Allocator, LockPolicy>::Node*
+CDS::LinkedList<T, Allocator, LockPolicy>::Seek(size_t index) const
+{
+    std::unique_lock<ReaderCacheMutex<LockPolicy>> lastLock(lastMtx, std::try_to_lock);
+
+    // resume from the last node when it is not past index
+    Node* current = head;
+    size_t count = 0;
+    if (lastLock.owns_lock() && lastNode && lastVersion == version && lastIndex <= index)
+    {
+        current = lastNode;
+        count = lastIndex;
+    }
+    CDS_STAT(Seeks, 1);
+    CDS_STAT(SeekSteps, index - count);
+
+    while (count < index)
+    {
+        current = current->next;
+        count++;
+    }
+
+    if (lastLock.owns_lock())
+    {
+        lastNode = current;
+        lastIndex = index;
+        lastVersion = version;
+    }
+    return current;
+}
+
 // Searches for $value in the list.
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy>
 bool
-CDS::LinkedList<T>::Search(const T& value)
+CDS::LinkedList<T, Allocator, LockPolicy>::Search(const T& value)
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    ReadGuard lock(mtx);
+    CDS_STAT(Searches, 1);
+    CDS_STAT(Lookups, 1);
     Node* current = head;
+    size_t steps = 0;
     while (current)
     {
+        steps++;
         if (current->data == value)
         {
+            CDS_STAT(LookupSteps, steps);
             return true;
         }
         current = current->next;
     }
+    CDS_STAT(LookupSteps, steps);
     return false;
 }
 
 // Retrieves value at index
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy>
 T*
-CDS::LinkedList<T>::Get(size_t index)
+CDS::LinkedList<T, Allocator, LockPolicy>::Get(size_t index)
 {
+    ReadGuard lock(mtx);
+    CDS_STAT(Gets, 1);
+
     // first check if index is in range
     if (index >= size)
     {
@@ -50,57 +193,106 @@ CDS::LinkedList<T>::Get(size_t index)
         return nullptr;
     }
 
-    // otherwise, index is OK, lock, traverse, and retrieve
-    std::lock_guard<std::mutex> lock(mtx);
-    Node* current = head;
-
-    size_t count = 0;
-    while (count <= index)
-        current = current->next;
-    return &current->data;
+    // otherwise, index is OK, traverse, and retrieve
+    return &Seek(index)->data;
 }
 
 // Searches for value. If found, returns its index. If not found, returns npos.
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy>
 size_t
-CDS::LinkedList<T>::IndexOf(const T& value)
+CDS::LinkedList<T, Allocator, LockPolicy>::IndexOf(const T& value)
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    ReadGuard lock(mtx);
+    CDS_STAT(IndexOfs, 1);
     Node* current = head;
     size_t index = 0;
     while (current)
     {
         if (current->data == value)
         {
+            CDS_STAT(IndexOfSteps, index + 1);
             return index;
         }
         index++;
         current = current->next;
     }
+    CDS_STAT(IndexOfSteps, index);
     return npos;
 }
 
 // Inserts to the beginning of the list.
 // Beginning is chosen as default for O(1) insertions.
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy>
 bool
-CDS::LinkedList<T>::Insert(const T& value)
+CDS::LinkedList<T, Allocator, LockPolicy>::Insert(const T& value)
 {
     return Insert(value, 0);
 }
 
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy>
+bool
+CDS::LinkedList<T, Allocator, LockPolicy>::Insert(const T& value, size_t index)
+{
+    return Emplace(index, value);
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
 bool
-CDS::LinkedList<T>::Insert(const T& value, size_t index)
+CDS::LinkedList<T, Allocator, LockPolicy>::Insert(T&& value)
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    return Emplace(0, std::move(value));
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
+bool
+CDS::LinkedList<T, Allocator, LockPolicy>::Insert(T&& value, size_t index)
+{
+    return Emplace(index, std::move(value));
+}
+
+// constructs the value in place at index, with no temporary copy
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename... Args>
+bool
+CDS::LinkedList<T, Allocator, LockPolicy>::Emplace(size_t index, Args&&... args)
+{
+    WriteGuard lock(mtx);
+    return EmplaceLocked(index, std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename... Args>
+bool
+CDS::LinkedList<T, Allocator, LockPolicy>::EmplaceFront(Args&&... args)
+{
+    WriteGuard lock(mtx);
+    return EmplaceLocked(0, std::forward<Args>(args)...);
+}
+
+// appends at the end. Without a tail pointer this walks the list.
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename... Args>
+bool
+CDS::LinkedList<T, Allocator, LockPolicy>::EmplaceBack(Args&&... args)
+{
+    WriteGuard lock(mtx);
+    return EmplaceLocked(size, std::forward<Args>(args)...);
+}
+
+// performs the insertion. Caller must hold a WriteGuard.
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename... Args>
+bool
+CDS::LinkedList<T, Allocator, LockPolicy>::EmplaceLocked(size_t index, Args&&... args)
+{
+    CDS_STAT(Inserts, 1);
 
     // Report failure if index > size
     if (index > size)
         return false;
 
     // Otherwise, define the node.
-    Node* newNode = new Node(value);
+    Node* newNode = CreateNode(std::forward<Args>(args)...);
 
     // list is empty
     if (head == nullptr)
@@ -117,9 +309,7 @@ CDS::LinkedList<T>::Insert(const T& value, size_t index)
     else
     {
         // traverse to node just before insert
-        Node* current = head;
-        for (size_t i = 0; i < index - 1; ++i)
-            current = current->next;
+        Node* current = Seek(index - 1);
 
         // perform insertion
         newNode->next = current->next;
@@ -128,15 +318,25 @@ CDS::LinkedList<T>::Insert(const T& value, size_t index)
 
     // insertion was successful. increment size & indicate success
     size++;
+    version++;
+
+    // sequential inserts continue from the new node
+    std::unique_lock<ReaderCacheMutex<LockPolicy>> lastLock(lastMtx, std::try_to_lock);
+    if (lastLock.owns_lock())
+    {
+        lastNode = newNode;
+        lastIndex = index;
+        lastVersion = version;
+    }
     return true;
 }
 
 // prints the list, separated by spaces
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy>
 void
-CDS::LinkedList<T>::Print()
+CDS::LinkedList<T, Allocator, LockPolicy>::Print()
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    ReadGuard lock(mtx);
     Node* current = head;
     while (current)
     {
@@ -147,48 +347,478 @@ CDS::LinkedList<T>::Print()
 }
 
 // removes the specified value. This removes the first value found, not all instances.
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy>
 bool
-CDS::LinkedList<T>::Remove(const T& value)
+CDS::LinkedList<T, Allocator, LockPolicy>::Remove(const T& value)
 {
-    std::lock_guard<std::mutex> lock(mtx);
+    WriteGuard lock(mtx);
+    CDS_STAT(Removes, 1);
+    CDS_STAT(Lookups, 1);
     Node* current = head;
     Node* prev = nullptr;
+    size_t steps = 0;
     while (current)
     {
+        steps++;
         if (current->data == value)
         {
+            CDS_STAT(LookupSteps, steps);
             if (prev)
                 prev->next = current->next;
             else
                 head = current->next;
-            delete current;
+            DestroyNode(current);
             size--;
+            version++;
             return true;
         }
         prev = current;
         current = current->next;
     }
+    CDS_STAT(LookupSteps, steps);
     return false;
 }
 
-template <typename T>
+// Inserts [first, last) at index, in order. Nodes are allocated before the
+// lock is taken, then spliced in with one walk.
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename InputIt>
+bool
+CDS::LinkedList<T, Allocator, LockPolicy>::InsertRange(InputIt first, InputIt last, size_t index)
+{
+    // build the chain unlocked
+    Node* chainHead = nullptr;
+    Node* chainTail = nullptr;
+    size_t count = 0;
+    try
+    {
+        for (; first != last; ++first)
+        {
+            Node* node = CreateNode(*first);
+            if (chainTail)
+                chainTail->next = node;
+            else
+                chainHead = node;
+            chainTail = node;
+            count++;
+        }
+    }
+    catch (...)
+    {
+        DestroyChain(chainHead);
+        throw;
+    }
+
+    WriteGuard lock(mtx);
+    CDS_STAT(Inserts, 1);
+
+    // Report failure if index > size
+    if (index > size)
+    {
+        DestroyChain(chainHead);
+        return false;
+    }
+    if (chainHead == nullptr)
+        return true;
+
+    // link the chain after the node before index
+    if (index == 0)
+    {
+        chainTail->next = head;
+        head = chainHead;
+    }
+    else
+    {
+        Node* before = Seek(index - 1);
+        chainTail->next = before->next;
+        before->next = chainHead;
+    }
+
+    size = size + count;
+    version++;
+    return true;
+}
+
+// Removes every element for which pred holds, in one pass. Returns the count.
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename Pred>
+size_t
+CDS::LinkedList<T, Allocator, LockPolicy>::RemoveIf(Pred pred)
+{
+    // unlink every match into a private chain, then free it unlocked
+    Node* garbage = nullptr;
+    size_t removed = 0;
+    {
+        WriteGuard lock(mtx);
+        CDS_STAT(Removes, 1);
+        Node* current = head;
+        Node* prev = nullptr;
+        while (current)
+        {
+            Node* next = current->next;
+            if (pred(current->data))
+            {
+                if (prev)
+                    prev->next = next;
+                else
+                    head = next;
+                current->next = garbage;
+                garbage = current;
+                removed++;
+            }
+            else
+            {
+                prev = current;
+            }
+            current = next;
+        }
+        size = size - removed;
+        if (removed)
+            version++;
+    }
+
+    DestroyChain(garbage);
+    return removed;
+}
+
+// Removes every instance of value. Returns the count.
+template <typename T, typename Allocator, typename LockPolicy>
+size_t
+CDS::LinkedList<T, Allocator, LockPolicy>::RemoveAll(const T& value)
+{
+    return RemoveIf([&value](const T& data) { return data == value; });
+}
+
+// Moves all of other's elements onto the end of this list, leaving other
+// empty. Nodes are spliced when both allocators can free them.
+template <typename T, typename Allocator, typename LockPolicy>
 void
-CDS::LinkedList<T>::Clear()
+CDS::LinkedList<T, Allocator, LockPolicy>::Append(LinkedList&& other)
 {
-    while (head)
+    if (this == &other)
+        return;
+
+    std::scoped_lock lock(mtx, other.mtx);
+    if (alloc == other.alloc)
     {
-        Node* temp = head;
-        head = head->next;
-        delete temp;
+        // splice onto the end, walking this list once
+        if (head == nullptr)
+        {
+            head = other.head;
+        }
+        else
+        {
+            Node* last = head;
+            while (last->next)
+                last = last->next;
+            last->next = other.head;
+        }
+        other.head = nullptr;
+        size = size + static_cast<size_t>(other.size);
     }
+    else
+    {
+        for (Node* current = other.head; current; current = current->next)
+            EmplaceLocked(size, std::move(current->data));
+        other.DestroyAll();
+    }
+    other.size = 0;
+    version++;
+    other.version++;
+}
+
+// Sorts by comp with a bottom-up merge sort, relinking nodes in place.
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename Compare>
+void
+CDS::LinkedList<T, Allocator, LockPolicy>::Sort(Compare comp)
+{
+    WriteGuard lock(mtx);
+    head = SortChain(head, comp);
+    version++;
+}
+
+// Merges other, sorted by comp, into this sorted list, leaving other empty.
+// Among equal elements ours come first. Nodes are spliced when both
+// allocators can free them, otherwise the elements are moved.
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename Compare>
+void
+CDS::LinkedList<T, Allocator, LockPolicy>::Merge(LinkedList&& other, Compare comp)
+{
+    if (this == &other)
+        return;
+
+    std::scoped_lock lock(mtx, other.mtx);
+    Node* theirs = other.head;
+    size_t count = other.size;
+    if (alloc == other.alloc)
+    {
+        other.head = nullptr;
+    }
+    else
+    {
+        theirs = nullptr;
+        Node** link = &theirs;
+        try
+        {
+            for (Node* current = other.head; current; current = current->next)
+            {
+                *link = CreateNode(std::move(current->data));
+                link = &(*link)->next;
+            }
+        }
+        catch (...)
+        {
+            DestroyChain(theirs);
+            throw;
+        }
+        other.DestroyAll();
+    }
+
+    head = MergeChains(head, theirs, comp);
+    size = size + count;
+    other.size = 0;
+    version++;
+    other.version++;
+}
+
+// Removes each element for which pred(kept, element) holds, kept being the
+// last element not removed, in one pass. Returns the count.
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename BinaryPred>
+size_t
+CDS::LinkedList<T, Allocator, LockPolicy>::Unique(BinaryPred pred)
+{
+    // unlink every duplicate into a private chain, then free it unlocked
+    Node* garbage = nullptr;
+    size_t removed = 0;
+    {
+        WriteGuard lock(mtx);
+        Node* current = head;
+        while (current && current->next)
+        {
+            Node* next = current->next;
+            if (pred(current->data, next->data))
+            {
+                current->next = next->next;
+                next->next = garbage;
+                garbage = next;
+                removed++;
+            }
+            else
+            {
+                current = next;
+            }
+        }
+        size = size - removed;
+        if (removed)
+            version++;
+    }
+
+    DestroyChain(garbage);
+    return removed;
+}
+
+// Sorts a sublist per thread of pool, then merges them, under the write lock.
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename Compare>
+void
+CDS::LinkedList<T, Allocator, LockPolicy>::ParallelSort(Compare comp, ThreadPool& pool)
+{
+    WriteGuard lock(mtx);
+    head = ParallelSortChain(head, size, comp, pool);
+    version++;
+}
+
+// Copies of every element for which pred holds, in list order, tested by a
+// sublist per thread of pool under the read lock.
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename Pred>
+std::vector<T>
+CDS::LinkedList<T, Allocator, LockPolicy>::ParallelFindAll(Pred pred, ThreadPool& pool) const
+{
+    ReadGuard lock(mtx);
+    return ParallelFindAllChain<T>(head, size, pred, pool);
+}
+
+// Frees a detached chain linked through next.
+template <typename T, typename Allocator, typename LockPolicy>
+void
+CDS::LinkedList<T, Allocator, LockPolicy>::DestroyChain(Node* chain)
+{
+    while (chain)
+    {
+        Node* temp = chain;
+        chain = chain->next;
+        DestroyNode(temp);
+    }
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
+void
+CDS::LinkedList<T, Allocator, LockPolicy>::Clear()
+{
+    WriteGuard lock(mtx);
+    CDS_STAT(Clears, 1);
+    DestroyAll();
     size = 0;
+    version++;
+}
+
+// iterators start at head; end is one past the last node
+template <typename T, typename Allocator, typename LockPolicy>
+typename CDS::LinkedList<T, Allocator, LockPolicy>::iterator
+CDS::LinkedList<T, Allocator, LockPolicy>::begin()
+{
+    return iterator(head);
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
+typename CDS::LinkedList<T, Allocator, LockPolicy>::iterator
+CDS::LinkedList<T, Allocator, LockPolicy>::end()
+{
+    return iterator(nullptr);
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
+typename CDS::LinkedList<T, Allocator, LockPolicy>::const_iterator
+CDS::LinkedList<T, Allocator, LockPolicy>::begin() const
+{
+    return const_iterator(head);
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
+typename CDS::LinkedList<T, Allocator, LockPolicy>::const_iterator
+CDS::LinkedList<T, Allocator, LockPolicy>::end() const
+{
+    return const_iterator(nullptr);
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
+typename CDS::LinkedList<T, Allocator, LockPolicy>::const_iterator
+CDS::LinkedList<T, Allocator, LockPolicy>::cbegin() const
+{
+    return const_iterator(head);
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
+typename CDS::LinkedList<T, Allocator, LockPolicy>::const_iterator
+CDS::LinkedList<T, Allocator, LockPolicy>::cend() const
+{
+    return const_iterator(nullptr);
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
+typename CDS::LinkedList<T, Allocator, LockPolicy>::Cursor
+CDS::LinkedList<T, Allocator, LockPolicy>::OpenCursor() const
+{
+    return Cursor(*this);
+}
+
+// visits every element in order under one read lock
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename Fn>
+void
+CDS::LinkedList<T, Allocator, LockPolicy>::ForEach(Fn fn) const
+{
+    ReadGuard lock(mtx);
+    for (Node* current = head; current; current = current->next)
+        fn(static_cast<const T&>(current->data));
+}
+
+// Copies the list under the read lock. The copy is cached and handed to every
+// caller until the next modification, so repeated snapshots of a quiet list
+// cost no walk.
+template <typename T, typename Allocator, typename LockPolicy>
+std::shared_ptr<const std::vector<T>>
+CDS::LinkedList<T, Allocator, LockPolicy>::Snapshot() const
+{
+    ReadGuard lock(mtx);
+    std::lock_guard<std::mutex> cacheLock(snapshotMtx);
+    if (snapshot && snapshotVersion == version)
+        return snapshot;
+
+    auto copy = std::make_shared<std::vector<T>>();
+    copy->reserve(size);
+    for (Node* current = head; current; current = current->next)
+        copy->push_back(current->data);
+
+    snapshot = std::move(copy);
+    snapshotVersion = version;
+    return snapshot;
 }
 
-template <typename T>
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename S>
+bool
+CDS::LinkedList<T, Allocator, LockPolicy>::Save(const std::string& path) const
+{
+    auto cursor = OpenCursor();
+    return WriteListFile<S>(path, cursor.begin(), cursor.end(), cursor.Size());
+}
+
+// Builds the new list aside, from the mapped file, and moves it in. With
+// the same allocator the move just takes the nodes.
+template <typename T, typename Allocator, typename LockPolicy>
+template <typename S>
+bool
+CDS::LinkedList<T, Allocator, LockPolicy>::Load(const std::string& path)
+{
+    MappedListView<T, S> view;
+    if (!view.Open(path))
+        return false;
+
+    LinkedList loaded{Allocator(alloc)};
+    loaded.InsertRange(view.begin(), view.end(), 0);
+    *this = std::move(loaded);
+    return true;
+}
+
+// optimistic read: size is only written under the lock, and is read without it
+template <typename T, typename Allocator, typename LockPolicy>
 size_t
-CDS::LinkedList<T>::Size()
+CDS::LinkedList<T, Allocator, LockPolicy>::Size()
 {
-    std::lock_guard<std::mutex> lock(mtx);
     return size;
 }
+
+// Sums the counters over every thread's stripe. Lock counters come from the
+// counted mutex, which is a plain mutex when stats are compiled out.
+template <typename T, typename Allocator, typename LockPolicy>
+CDS::ListStats
+CDS::LinkedList<T, Allocator, LockPolicy>::Stats() const
+{
+    ListStats totals;
+#ifdef CDS_ENABLE_STATS
+    for (size_t i = 0; i < StatCount; ++i)
+        totals.values[i] = stats.Sum(i);
+    ReadLockStats(mtx, totals);
+    statsSink.Emit(totals);
+#endif
+    return totals;
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
+void
+CDS::LinkedList<T, Allocator, LockPolicy>::ResetStats()
+{
+#ifdef CDS_ENABLE_STATS
+    // the sink sees the totals before they are zeroed
+    Stats();
+    stats.Reset();
+    ResetLockStats(mtx);
+#endif
+}
+
+template <typename T, typename Allocator, typename LockPolicy>
+void
+CDS::LinkedList<T, Allocator, LockPolicy>::SetStatsSink(std::string name, StatsSinkFn sink)
+{
+#ifdef CDS_ENABLE_STATS
+    statsSink.Set(std::move(name), std::move(sink));
+#else
+    (void)name;
+    (void)sink;
+#endif
+}
@@ -0,0 +1,50 @@
+// =================================================================
+// ListAlgorithms.hpp
+//  Description     Declares the sorting and parallel algorithms shared
+//                  by the lists
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_LISTALGORITHMS_HPP
+#define CDS_LISTALGORITHMS_HPP
+
+#include <cstddef>
+#include <libcds/ThreadPool.hpp>
+#include <vector>
+
+namespace CDS
+{
+    /**
+     * Algorithms over chains of nodes linked through next, each holding a
+     * data member. The caller holds the list's lock and fixes up anything
+     * else the list keeps (prev links, tail, index) afterwards. comp and
+     * pred are called from several threads at once by the parallel ones.
+     */
+
+    // nodes per parallel piece, below which another thread is not worth it
+    constexpr size_t ParallelGrain = 4096;
+
+    // merges two sorted chains into one, taking from a first among equals
+    template <typename Node, typename Compare>
+    Node* MergeChains(Node* a, Node* b, const Compare& comp);
+
+    // stable bottom-up merge sort of a chain, in O(n log n) time and O(1) space
+    template <typename Node, typename Compare>
+    Node* SortChain(Node* head, const Compare& comp);
+
+    // cuts a chain of count nodes into a sublist per thread, sorts those on
+    // pool, then merges neighbours pairwise, also on pool
+    template <typename Node, typename Compare>
+    Node* ParallelSortChain(Node* head, size_t count, const Compare& comp, ThreadPool& pool);
+
+    // copies, in order, of the data of the count nodes for which pred holds.
+    // Finding each thread's first node is one walk, so this pays off when
+    // pred costs more than following a pointer.
+    template <typename T, typename Node, typename Pred>
+    std::vector<T> ParallelFindAllChain(Node* head, size_t count, const Pred& pred, ThreadPool& pool);
+} // namespace CDS
+
+#include <libcds/ListAlgorithms.tpp>
+
+#endif // CDS_LISTALGORITHMS_HPP
@@ -0,0 +1,154 @@
+// =================================================================
+// ListAlgorithms.tpp
+//  Description     Implementation of the list algorithms
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <algorithm>
+#include <libcds/ListAlgorithms.hpp>
+
+namespace CDS
+{
+    // number of pieces to split count nodes into on pool, at least one
+    inline size_t
+    ParallelPieces(size_t count, const ThreadPool& pool)
+    {
+        return std::max<size_t>(1, std::min(pool.Size() + 1, count / ParallelGrain));
+    }
+
+    // cuts count nodes from head into pieces of near-equal length, recording
+    // where each starts, and ends each piece with a null next when cut
+    template <typename Node>
+    void
+    SplitChain(Node* head, size_t count, bool cut, std::vector<Node*>& starts, std::vector<size_t>& lengths)
+    {
+        Node* current = head;
+        for (size_t p = 0; p < starts.size(); ++p)
+        {
+            lengths[p] = count / starts.size() + (p < count % starts.size() ? 1 : 0);
+            starts[p] = current;
+            if (lengths[p] == 0)
+                continue;
+            for (size_t i = 1; i < lengths[p]; ++i)
+                current = current->next;
+            Node* next = current->next;
+            if (cut)
+                current->next = nullptr;
+            current = next;
+        }
+    }
+} // namespace CDS
+
+template <typename Node, typename Compare>
+Node*
+CDS::MergeChains(Node* a, Node* b, const Compare& comp)
+{
+    Node* result = nullptr;
+    Node** link = &result;
+    while (a && b)
+    {
+        if (comp(b->data, a->data))
+        {
+            *link = b;
+            b = b->next;
+        }
+        else
+        {
+            *link = a;
+            a = a->next;
+        }
+        link = &(*link)->next;
+    }
+    *link = a ? a : b;
+    return result;
+}
+
+// Each node is detached and merged up through bins of sorted runs, bins[i]
+// holding 2^i nodes. A bin always holds nodes from before the run merged
+// into it, so taking from the bin first among equals keeps the sort stable.
+template <typename Node, typename Compare>
+Node*
+CDS::SortChain(Node* head, const Compare& comp)
+{
+    constexpr size_t BinCount = 64;
+    Node* bins[BinCount] = {};
+
+    while (head)
+    {
+        Node* run = head;
+        head = head->next;
+        run->next = nullptr;
+
+        size_t bin = 0;
+        for (; bin < BinCount - 1 && bins[bin]; ++bin)
+        {
+            run = MergeChains(bins[bin], run, comp);
+            bins[bin] = nullptr;
+        }
+        bins[bin] = run;
+    }
+
+    // larger bins hold earlier nodes
+    Node* result = nullptr;
+    for (size_t bin = 0; bin < BinCount; ++bin)
+    {
+        if (bins[bin])
+            result = MergeChains(bins[bin], result, comp);
+    }
+    return result;
+}
+
+template <typename Node, typename Compare>
+Node*
+CDS::ParallelSortChain(Node* head, size_t count, const Compare& comp, ThreadPool& pool)
+{
+    size_t pieces = ParallelPieces(count, pool);
+    if (pieces < 2)
+        return SortChain(head, comp);
+
+    std::vector<Node*> runs(pieces);
+    std::vector<size_t> lengths(pieces);
+    SplitChain(head, count, true, runs, lengths);
+    pool.ParallelFor(pieces, [&](size_t p) { runs[p] = SortChain(runs[p], comp); });
+
+    // merge neighbours, the earlier run on the left so equal elements keep
+    // their order, halving the runs each round
+    for (size_t width = 1; width < pieces; width *= 2)
+    {
+        size_t pairs = (pieces + 2 * width - 1) / (2 * width);
+        pool.ParallelFor(pairs, [&](size_t k) {
+            size_t left = k * 2 * width;
+            size_t right = left + width;
+            if (right < pieces)
+                runs[left] = MergeChains(runs[left], runs[right], comp);
+        });
+    }
+    return runs[0];
+}
+
+template <typename T, typename Node, typename Pred>
+std::vector<T>
+CDS::ParallelFindAllChain(Node* head, size_t count, const Pred& pred, ThreadPool& pool)
+{
+    size_t pieces = ParallelPieces(count, pool);
+    std::vector<Node*> starts(pieces);
+    std::vector<size_t> lengths(pieces);
+    SplitChain(head, count, false, starts, lengths);
+
+    std::vector<std::vector<T>> found(pieces);
+    pool.ParallelFor(pieces, [&](size_t p) {
+        Node* current = starts[p];
+        for (size_t i = 0; i < lengths[p]; ++i)
+        {
+            if (pred(current->data))
+                found[p].push_back(current->data);
+            current = current->next;
+        }
+    });
+
+    std::vector<T> result = std::move(found[0]);
+    for (size_t p = 1; p < pieces; ++p)
+        result.insert(result.end(), found[p].begin(), found[p].end());
+    return result;
+}
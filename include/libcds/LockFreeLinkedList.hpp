@@ -0,0 +1,105 @@
+// =================================================================
+// LockFreeLinkedList.hpp
+//  Description     Declaration of LockFreeLinkedList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_LOCKFREELINKEDLIST_HPP
+#define CDS_LOCKFREELINKEDLIST_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <libcds/DataStructure.hpp>
+#include <libcds/HazardPointer.hpp>
+#include <util.hpp>
+
+namespace CDS
+{
+    /**
+     * LockFreeLinkedList - Class to create a lock-free singly linked list.
+     * Features:
+     *      Templated data type
+     *      Lock-free using Harris/Michael marked-pointer deletion
+     *      Safe memory reclamation using hazard pointers
+     *      List operations (insert, indexOf, remove, print, etc.)
+     *      Destructor
+     *
+     * Removal first marks the low bit of the victim's next pointer (logical
+     * delete), then unlinks it with a CAS on its predecessor. Any traversal
+     * that meets a marked node helps unlink it. Unlinked nodes are retired to
+     * the hazard pointer domain rather than deleted outright.
+     *
+     * Note: the pointer returned by Get() stays valid only until the element
+     * is removed by some thread.
+     */
+    template <typename T>
+    class LockFreeLinkedList final : IList<T>
+    {
+        static_assert(CdsUtil::has_operator_equal<T>::value, "LockFreeLinkedList requires T to have an == operator");
+
+    private:
+        struct Node
+        {
+            T data;
+            std::atomic<Node*> next;
+
+            Node(const T& value) : data(value), next(nullptr) {}
+        };
+
+        // a window into the list, as found by Find()
+        struct Position
+        {
+            std::atomic<Node*>* prev;
+            Node* cur;
+            Node* next;
+            size_t index;
+        };
+
+        std::atomic<Node*> head;
+        std::atomic<size_t> size;
+
+        // marked pointer helpers
+        static bool IsMarked(Node* p) { return (reinterpret_cast<uintptr_t>(p) & 1) != 0; }
+        static Node* Mark(Node* p) { return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(p) | 1); }
+        static Node* Unmark(Node* p) { return reinterpret_cast<Node*>(reinterpret_cast<uintptr_t>(p) & ~uintptr_t(1)); }
+
+        // walks the live nodes, unlinking marked ones on the way, until
+        // match(data, index) holds. On return pos.cur is protected.
+        template <typename Match>
+        bool Find(Match match, Position& pos);
+
+        // removes the first live node for which match(data, index) holds
+        template <typename Match>
+        bool RemoveFirst(Match match);
+
+    public:
+        // returned when index is not found for indexOf();
+        const size_t npos = static_cast<size_t>(-1);
+
+        // default constructor
+        LockFreeLinkedList() : head(nullptr), size(0) {}
+
+        // destructor
+        virtual ~LockFreeLinkedList();
+
+        // IDataStructure members
+        virtual bool Search(const T& value) override;
+        virtual void Print() override;
+        virtual bool Remove(const T& value) override;
+        virtual void Clear() override;
+        virtual size_t Size() override;
+
+        // IList members
+        virtual size_t IndexOf(const T& value) override;
+        virtual bool Insert(const T& value) override;
+        virtual bool Insert(const T& value, size_t index) override;
+        virtual T* Get(size_t index) override;
+    };
+} // namespace CDS
+
+#include <libcds/LockFreeLinkedList.tpp>
+
+#endif // CDS_LOCKFREELINKEDLIST_HPP
@@ -0,0 +1,243 @@
+// =================================================================
+// LockFreeLinkedList.tpp
+//  Description     Template Implementation of LockFreeLinkedList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <libcds/LockFreeLinkedList.hpp>
+#include <vector>
+
+// Destructor deletes each node still linked into the list.
+// Nodes already unlinked belong to the hazard pointer domain.
+template <typename T>
+CDS::LockFreeLinkedList<T>::~LockFreeLinkedList()
+{
+    Node* current = Unmark(head.load());
+    while (current)
+    {
+        Node* temp = current;
+        current = Unmark(current->next.load());
+        delete temp;
+    }
+}
+
+// Michael's search: hazard slot 0 guards cur, slot 1 guards the node owning prev.
+template <typename T>
+template <typename Match>
+bool
+CDS::LockFreeLinkedList<T>::Find(Match match, Position& pos)
+{
+    while (true)
+    {
+        std::atomic<Node*>* prev = &head;
+        Node* cur = prev->load();
+        size_t index = 0;
+        bool restart = false;
+
+        while (!restart)
+        {
+            // reached the end without a match
+            if (cur == nullptr)
+            {
+                pos = {prev, nullptr, nullptr, index};
+                return false;
+            }
+
+            // publish cur, then make sure it is still reachable
+            HazardPointers::Set(0, cur);
+            if (prev->load() != cur)
+            {
+                restart = true;
+                continue;
+            }
+
+            Node* next = cur->next.load();
+            if (IsMarked(next))
+            {
+                // cur is logically deleted, help unlink it
+                Node* expected = cur;
+                if (!prev->compare_exchange_strong(expected, Unmark(next)))
+                {
+                    restart = true;
+                    continue;
+                }
+                HazardPointers::Retire(cur);
+                cur = Unmark(next);
+            }
+            else
+            {
+                if (match(cur->data, index))
+                {
+                    pos = {prev, cur, next, index};
+                    return true;
+                }
+
+                // advance, keeping the new predecessor protected
+                prev = &cur->next;
+                HazardPointers::Set(1, cur);
+                cur = next;
+                index++;
+            }
+        }
+    }
+}
+
+template <typename T>
+template <typename Match>
+bool
+CDS::LockFreeLinkedList<T>::RemoveFirst(Match match)
+{
+    Position pos;
+    while (true)
+    {
+        if (!Find(match, pos))
+        {
+            HazardPointers::ClearAll();
+            return false;
+        }
+
+        // logically delete by marking cur's next pointer
+        Node* next = pos.next;
+        if (!pos.cur->next.compare_exchange_strong(next, Mark(next)))
+            continue;
+        size--;
+
+        // then try to unlink it. If that fails, a traversal cleans it up.
+        Node* expected = pos.cur;
+        if (pos.prev->compare_exchange_strong(expected, next))
+            HazardPointers::Retire(pos.cur);
+        else
+            Find([](const T&, size_t) { return false; }, pos);
+
+        HazardPointers::ClearAll();
+        return true;
+    }
+}
+
+// Searches for $value in the list.
+template <typename T>
+bool
+CDS::LockFreeLinkedList<T>::Search(const T& value)
+{
+    Position pos;
+    bool found = Find([&value](const T& data, size_t) { return data == value; }, pos);
+    HazardPointers::ClearAll();
+    return found;
+}
+
+// Retrieves value at index
+template <typename T>
+T*
+CDS::LockFreeLinkedList<T>::Get(size_t index)
+{
+    Position pos;
+    T* ret = nullptr;
+    if (Find([index](const T&, size_t i) { return i == index; }, pos))
+        ret = &pos.cur->data;
+    HazardPointers::ClearAll();
+    return ret;
+}
+
+// Searches for value. If found, returns its index. If not found, returns npos.
+template <typename T>
+size_t
+CDS::LockFreeLinkedList<T>::IndexOf(const T& value)
+{
+    Position pos;
+    size_t ret = npos;
+    if (Find([&value](const T& data, size_t) { return data == value; }, pos))
+        ret = pos.index;
+    HazardPointers::ClearAll();
+    return ret;
+}
+
+// Inserts to the beginning of the list.
+// Beginning is chosen as default for O(1) insertions.
+template <typename T>
+bool
+CDS::LockFreeLinkedList<T>::Insert(const T& value)
+{
+    return Insert(value, 0);
+}
+
+template <typename T>
+bool
+CDS::LockFreeLinkedList<T>::Insert(const T& value, size_t index)
+{
+    // count the node up front, so a racing Remove never drives size below 0
+    Node* newNode = new Node(value);
+    size++;
+
+    Position pos;
+    while (true)
+    {
+        // locate the index'th live node, or the end when index == size
+        if (!Find([index](const T&, size_t i) { return i == index; }, pos) && pos.index != index)
+        {
+            // Report failure if index > size
+            HazardPointers::ClearAll();
+            size--;
+            delete newNode;
+            return false;
+        }
+
+        // link in front of cur, retrying if the window changed underneath us
+        newNode->next.store(pos.cur, std::memory_order_relaxed);
+        Node* expected = pos.cur;
+        if (pos.prev->compare_exchange_strong(expected, newNode))
+        {
+            HazardPointers::ClearAll();
+            return true;
+        }
+    }
+}
+
+// prints the list, separated by spaces
+template <typename T>
+void
+CDS::LockFreeLinkedList<T>::Print()
+{
+    // collect a copy first, since the traversal may restart
+    std::vector<T> values;
+    Position pos;
+    Find(
+        [&values](const T& data, size_t i)
+        {
+            if (i == 0)
+                values.clear();
+            values.push_back(data);
+            return false;
+        },
+        pos);
+    HazardPointers::ClearAll();
+
+    for (const T& v : values)
+        std::cout << v << " ";
+    std::cout << std::endl;
+}
+
+// removes the specified value. This removes the first value found, not all instances.
+template <typename T>
+bool
+CDS::LockFreeLinkedList<T>::Remove(const T& value)
+{
+    return RemoveFirst([&value](const T& data, size_t) { return data == value; });
+}
+
+// removes nodes from the front until the list is observed empty.
+template <typename T>
+void
+CDS::LockFreeLinkedList<T>::Clear()
+{
+    while (RemoveFirst([](const T&, size_t) { return true; }))
+    {
+    }
+}
+
+template <typename T>
+size_t
+CDS::LockFreeLinkedList<T>::Size()
+{
+    return size.load();
+}
@@ -0,0 +1,106 @@
+// =================================================================
+// LockFreeQueue.hpp
+//  Description     Declaration of LockFreeQueue
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_LOCKFREEQUEUE_HPP
+#define CDS_LOCKFREEQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <libcds/DataStructure.hpp>
+#include <libcds/HazardPointer.hpp>
+#include <new>
+#include <util.hpp>
+
+namespace CDS
+{
+    /**
+     * LockFreeQueue - Class to create an unbounded FIFO queue for any number
+     *  of producers and consumers.
+     * Features:
+     *      Templated data type
+     *      Lock-free, after the Michael-Scott queue
+     *      Safe memory reclamation using hazard pointers
+     *      PushN links a whole batch with one CAS
+     *      Head and tail on separate cache lines
+     *      Queue operations (push, pop, tryPop, pushN, popN)
+     *      Destructor
+     *
+     * The head always points at a dummy node, and the front element lives in
+     * the node after it. A pop swings head forward, making that node the new
+     * dummy, and retires the old one. A tail that lags behind the last node
+     * is helped forward by whichever thread notices.
+     *
+     * Note: Search, Print, and Remove walk the nodes directly, and are only
+     * safe while no other thread is using the queue.
+     */
+    template <typename T>
+    class LockFreeQueue final : IDataStructure<T>
+    {
+        static_assert(CdsUtil::has_operator_equal<T>::value, "LockFreeQueue requires T to have an == operator");
+
+    private:
+        // the element is constructed only while the node is not the dummy
+        struct Node
+        {
+            std::atomic<Node*> next;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            Node() : next(nullptr) {}
+
+            T* Data() { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+
+        // consumers' line, then producers' line. The counters give Size().
+        alignas(CacheLineSize) std::atomic<Node*> head;
+        std::atomic<size_t> popped;
+        alignas(CacheLineSize) std::atomic<Node*> tail;
+        std::atomic<size_t> pushed;
+
+        // links the chain first..last, of count nodes, behind the last node
+        void LinkChain(Node* first, Node* last, size_t count);
+
+        // unlinks the front element, handing it to sink(T&&) before it is
+        // destroyed. False if empty.
+        template <typename Sink>
+        bool RemoveFirst(Sink sink);
+
+    public:
+        // default constructor
+        LockFreeQueue();
+
+        // destructor
+        virtual ~LockFreeQueue();
+
+        LockFreeQueue(const LockFreeQueue&) = delete;
+        LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+        // IDataStructure members
+        virtual bool Search(const T& value) override;
+        virtual void Print() override;
+        virtual bool Remove(const T& value) override;
+        virtual void Clear() override;
+        virtual size_t Size() override;
+
+        // queue members. Pop waits while empty.
+        void Push(const T& value);
+        void Push(T&& value);
+        void Pop(T& out);
+        bool TryPop(T& out);
+
+        // PushN links [first, last) with one CAS. PopN pops up to max into
+        // out. Both return how many elements moved.
+        template <typename InputIt>
+        size_t PushN(InputIt first, InputIt last);
+        template <typename OutputIt>
+        size_t PopN(OutputIt out, size_t max);
+    };
+} // namespace CDS
+
+#include <libcds/LockFreeQueue.tpp>
+
+#endif // CDS_LOCKFREEQUEUE_HPP
@@ -0,0 +1,246 @@
+// =================================================================
+// LockFreeQueue.tpp
+//  Description     Template Implementation of LockFreeQueue
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <libcds/LockFreeQueue.hpp>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+template <typename T>
+CDS::LockFreeQueue<T>::LockFreeQueue() : popped(0), pushed(0)
+{
+    Node* dummy = new Node();
+    head.store(dummy);
+    tail.store(dummy);
+}
+
+// Destructor deletes the dummy and each node still queued.
+// Popped nodes belong to the hazard pointer domain.
+template <typename T>
+CDS::LockFreeQueue<T>::~LockFreeQueue()
+{
+    Node* current = head.load();
+    Node* next = current->next.load();
+    delete current;
+    while (next)
+    {
+        current = next;
+        next = current->next.load();
+        current->Data()->~T();
+        delete current;
+    }
+}
+
+// Hazard slot 0 guards the last node while it is being extended.
+template <typename T>
+void
+CDS::LockFreeQueue<T>::LinkChain(Node* first, Node* last, size_t count)
+{
+    // counted first, so Size() never sees more pops than pushes
+    pushed.fetch_add(count);
+
+    while (true)
+    {
+        Node* t = HazardPointers::Protect(0, tail);
+        Node* next = t->next.load();
+        if (t != tail.load())
+            continue;
+
+        if (next != nullptr)
+        {
+            // tail is lagging, help it along first
+            tail.compare_exchange_weak(t, next);
+            continue;
+        }
+
+        if (t->next.compare_exchange_weak(next, first))
+        {
+            tail.compare_exchange_strong(t, last);
+            break;
+        }
+    }
+    HazardPointers::Clear(0);
+}
+
+// Hazard slot 0 guards the dummy, slot 1 the node holding the front element.
+template <typename T>
+template <typename Sink>
+bool
+CDS::LockFreeQueue<T>::RemoveFirst(Sink sink)
+{
+    while (true)
+    {
+        Node* h = HazardPointers::Protect(0, head);
+        Node* t = tail.load();
+        Node* next = HazardPointers::Protect(1, h->next);
+        if (h != head.load())
+            continue;
+
+        if (next == nullptr)
+        {
+            HazardPointers::ClearAll();
+            return false;
+        }
+
+        // never let head pass tail
+        if (h == t)
+        {
+            tail.compare_exchange_weak(t, next);
+            continue;
+        }
+
+        // next becomes the dummy. Only the winner touches its element.
+        if (head.compare_exchange_weak(h, next))
+        {
+            sink(std::move(*next->Data()));
+            next->Data()->~T();
+            HazardPointers::ClearAll();
+            HazardPointers::Retire(h);
+            popped.fetch_add(1);
+            return true;
+        }
+    }
+}
+
+template <typename T>
+void
+CDS::LockFreeQueue<T>::Push(const T& value)
+{
+    Node* node = new Node();
+    new (node->storage) T(value);
+    LinkChain(node, node, 1);
+}
+
+template <typename T>
+void
+CDS::LockFreeQueue<T>::Push(T&& value)
+{
+    Node* node = new Node();
+    new (node->storage) T(std::move(value));
+    LinkChain(node, node, 1);
+}
+
+template <typename T>
+bool
+CDS::LockFreeQueue<T>::TryPop(T& out)
+{
+    return RemoveFirst([&out](T&& value) { out = std::move(value); });
+}
+
+template <typename T>
+void
+CDS::LockFreeQueue<T>::Pop(T& out)
+{
+    while (!TryPop(out))
+        std::this_thread::yield();
+}
+
+// Builds the chain privately, so it becomes visible all at once.
+template <typename T>
+template <typename InputIt>
+size_t
+CDS::LockFreeQueue<T>::PushN(InputIt first, InputIt last)
+{
+    Node* chainHead = nullptr;
+    Node* chainTail = nullptr;
+    size_t count = 0;
+    for (; first != last; ++first)
+    {
+        Node* node = new Node();
+        new (node->storage) T(*first);
+        if (chainTail)
+            chainTail->next.store(node, std::memory_order_relaxed);
+        else
+            chainHead = node;
+        chainTail = node;
+        count++;
+    }
+
+    if (count)
+        LinkChain(chainHead, chainTail, count);
+    return count;
+}
+
+template <typename T>
+template <typename OutputIt>
+size_t
+CDS::LockFreeQueue<T>::PopN(OutputIt out, size_t max)
+{
+    size_t count = 0;
+    while (count < max && RemoveFirst([&out](T&& value) { *out++ = std::move(value); }))
+        count++;
+    return count;
+}
+
+// Searches for $value among the queued elements.
+template <typename T>
+bool
+CDS::LockFreeQueue<T>::Search(const T& value)
+{
+    for (Node* current = head.load()->next.load(); current; current = current->next.load())
+    {
+        if (*current->Data() == value)
+            return true;
+    }
+    return false;
+}
+
+// prints the queue front to back, separated by spaces
+template <typename T>
+void
+CDS::LockFreeQueue<T>::Print()
+{
+    for (Node* current = head.load()->next.load(); current; current = current->next.load())
+        std::cout << *current->Data() << " ";
+    std::cout << std::endl;
+}
+
+// removes the first instance of value, keeping the rest in order
+template <typename T>
+bool
+CDS::LockFreeQueue<T>::Remove(const T& value)
+{
+    std::vector<T> kept;
+    while (PopN(std::back_inserter(kept), static_cast<size_t>(-1)) != 0)
+    {
+    }
+
+    bool found = false;
+    for (auto it = kept.begin(); it != kept.end(); ++it)
+    {
+        if (*it == value)
+        {
+            kept.erase(it);
+            found = true;
+            break;
+        }
+    }
+
+    PushN(std::make_move_iterator(kept.begin()), std::make_move_iterator(kept.end()));
+    return found;
+}
+
+// pops until the queue is observed empty
+template <typename T>
+void
+CDS::LockFreeQueue<T>::Clear()
+{
+    while (RemoveFirst([](T&&) {}))
+    {
+    }
+}
+
+// approximate while other threads are pushing or popping
+template <typename T>
+size_t
+CDS::LockFreeQueue<T>::Size()
+{
+    size_t out = popped.load();
+    size_t in = pushed.load();
+    return in > out ? in - out : 0;
+}
@@ -0,0 +1,100 @@
+// =================================================================
+// LockFreeStack.hpp
+//  Description     Declaration of LockFreeStack
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_LOCKFREESTACK_HPP
+#define CDS_LOCKFREESTACK_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <libcds/DataStructure.hpp>
+#include <libcds/HazardPointer.hpp>
+#include <new>
+#include <util.hpp>
+
+namespace CDS
+{
+    /**
+     * LockFreeStack - Class to create an unbounded LIFO stack for any number
+     *  of threads.
+     * Features:
+     *      Templated data type
+     *      Lock-free, after Treiber's stack
+     *      Safe memory reclamation using hazard pointers, which also rules
+     *        out ABA on the top pointer
+     *      PushN pushes a whole batch with one CAS
+     *      Top pointer on its own cache line
+     *      Stack operations (push, pop, tryPop, pushN, popN)
+     *      Destructor
+     *
+     * Note: Search, Print, and Remove walk the nodes directly, and are only
+     * safe while no other thread is using the stack.
+     */
+    template <typename T>
+    class LockFreeStack final : IDataStructure<T>
+    {
+        static_assert(CdsUtil::has_operator_equal<T>::value, "LockFreeStack requires T to have an == operator");
+
+    private:
+        // next is fixed before the node is published
+        struct Node
+        {
+            Node* next;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            Node() : next(nullptr) {}
+
+            T* Data() { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+
+        alignas(CacheLineSize) std::atomic<Node*> top;
+        std::atomic<size_t> size;
+
+        // publishes the chain first..last, of count nodes, with first on top
+        void LinkChain(Node* first, Node* last, size_t count);
+
+        // unlinks the top element, handing it to sink(T&&) before it is
+        // destroyed. False if empty.
+        template <typename Sink>
+        bool RemoveFirst(Sink sink);
+
+    public:
+        // default constructor
+        LockFreeStack() : top(nullptr), size(0) {}
+
+        // destructor
+        virtual ~LockFreeStack();
+
+        LockFreeStack(const LockFreeStack&) = delete;
+        LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+        // IDataStructure members
+        virtual bool Search(const T& value) override;
+        virtual void Print() override;
+        virtual bool Remove(const T& value) override;
+        virtual void Clear() override;
+        virtual size_t Size() override;
+
+        // stack members. Pop waits while empty.
+        void Push(const T& value);
+        void Push(T&& value);
+        void Pop(T& out);
+        bool TryPop(T& out);
+
+        // PushN pushes [first, last) in order with one CAS, leaving the last
+        // element on top. PopN pops up to max into out. Both return how many
+        // elements moved.
+        template <typename InputIt>
+        size_t PushN(InputIt first, InputIt last);
+        template <typename OutputIt>
+        size_t PopN(OutputIt out, size_t max);
+    };
+} // namespace CDS
+
+#include <libcds/LockFreeStack.tpp>
+
+#endif // CDS_LOCKFREESTACK_HPP
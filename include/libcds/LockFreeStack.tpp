@@ -0,0 +1,207 @@
+// =================================================================
+// LockFreeStack.tpp
+//  Description     Template Implementation of LockFreeStack
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <libcds/LockFreeStack.hpp>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Destructor deletes each node still on the stack.
+// Popped nodes belong to the hazard pointer domain.
+template <typename T>
+CDS::LockFreeStack<T>::~LockFreeStack()
+{
+    Node* current = top.load();
+    while (current)
+    {
+        Node* temp = current;
+        current = current->next;
+        temp->Data()->~T();
+        delete temp;
+    }
+}
+
+template <typename T>
+void
+CDS::LockFreeStack<T>::LinkChain(Node* first, Node* last, size_t count)
+{
+    // counted first, so a racing pop never takes size below zero
+    size.fetch_add(count);
+
+    Node* expected = top.load(std::memory_order_relaxed);
+    do
+    {
+        last->next = expected;
+    } while (!top.compare_exchange_weak(expected, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
+// Hazard slot 0 guards the top node, so it cannot be freed and reused
+// while its next pointer is read and the CAS is attempted.
+template <typename T>
+template <typename Sink>
+bool
+CDS::LockFreeStack<T>::RemoveFirst(Sink sink)
+{
+    while (true)
+    {
+        Node* t = HazardPointers::Protect(0, top);
+        if (t == nullptr)
+        {
+            HazardPointers::Clear(0);
+            return false;
+        }
+
+        // only the winner touches the element
+        if (top.compare_exchange_weak(t, t->next))
+        {
+            HazardPointers::Clear(0);
+            sink(std::move(*t->Data()));
+            t->Data()->~T();
+            HazardPointers::Retire(t);
+            size.fetch_sub(1);
+            return true;
+        }
+    }
+}
+
+template <typename T>
+void
+CDS::LockFreeStack<T>::Push(const T& value)
+{
+    Node* node = new Node();
+    new (node->storage) T(value);
+    LinkChain(node, node, 1);
+}
+
+template <typename T>
+void
+CDS::LockFreeStack<T>::Push(T&& value)
+{
+    Node* node = new Node();
+    new (node->storage) T(std::move(value));
+    LinkChain(node, node, 1);
+}
+
+template <typename T>
+bool
+CDS::LockFreeStack<T>::TryPop(T& out)
+{
+    return RemoveFirst([&out](T&& value) { out = std::move(value); });
+}
+
+template <typename T>
+void
+CDS::LockFreeStack<T>::Pop(T& out)
+{
+    while (!TryPop(out))
+        std::this_thread::yield();
+}
+
+// Builds the chain privately, each new node pointing at the one before it.
+template <typename T>
+template <typename InputIt>
+size_t
+CDS::LockFreeStack<T>::PushN(InputIt first, InputIt last)
+{
+    Node* chainTop = nullptr;
+    Node* chainBottom = nullptr;
+    size_t count = 0;
+    for (; first != last; ++first)
+    {
+        Node* node = new Node();
+        new (node->storage) T(*first);
+        node->next = chainTop;
+        chainTop = node;
+        if (chainBottom == nullptr)
+            chainBottom = node;
+        count++;
+    }
+
+    if (count)
+        LinkChain(chainTop, chainBottom, count);
+    return count;
+}
+
+// pops one at a time, since a run of nodes cannot be protected at once
+template <typename T>
+template <typename OutputIt>
+size_t
+CDS::LockFreeStack<T>::PopN(OutputIt out, size_t max)
+{
+    size_t count = 0;
+    while (count < max && RemoveFirst([&out](T&& value) { *out++ = std::move(value); }))
+        count++;
+    return count;
+}
+
+// Searches for $value on the stack.
+template <typename T>
+bool
+CDS::LockFreeStack<T>::Search(const T& value)
+{
+    for (Node* current = top.load(); current; current = current->next)
+    {
+        if (*current->Data() == value)
+            return true;
+    }
+    return false;
+}
+
+// prints the stack top to bottom, separated by spaces
+template <typename T>
+void
+CDS::LockFreeStack<T>::Print()
+{
+    for (Node* current = top.load(); current; current = current->next)
+        std::cout << *current->Data() << " ";
+    std::cout << std::endl;
+}
+
+// removes the topmost instance of value, keeping the rest in order
+template <typename T>
+bool
+CDS::LockFreeStack<T>::Remove(const T& value)
+{
+    std::vector<T> kept;
+    while (PopN(std::back_inserter(kept), static_cast<size_t>(-1)) != 0)
+    {
+    }
+
+    bool found = false;
+    for (auto it = kept.begin(); it != kept.end(); ++it)
+    {
+        if (*it == value)
+        {
+            kept.erase(it);
+            found = true;
+            break;
+        }
+    }
+
+    // kept runs top to bottom, so push it back bottom first
+    PushN(std::make_move_iterator(kept.rbegin()), std::make_move_iterator(kept.rend()));
+    return found;
+}
+
+// pops until the stack is observed empty
+template <typename T>
+void
+CDS::LockFreeStack<T>::Clear()
+{
+    while (RemoveFirst([](T&&) {}))
+    {
+    }
+}
+
+// approximate while other threads are pushing or popping
+template <typename T>
+size_t
+CDS::LockFreeStack<T>::Size()
+{
+    return size.load();
+}
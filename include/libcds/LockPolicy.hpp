@@ -0,0 +1,93 @@
+// =================================================================
+// LockPolicy.hpp
+//  Description     Declares the locking policies used by the lists
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_LOCKPOLICY_HPP
+#define CDS_LOCKPOLICY_HPP
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+
+namespace CDS
+{
+    /**
+     * A locking policy supplies the mutex a container holds, the guards its
+     * read-only and mutating members take, and the counter type used for
+     * its size. Size() reads that counter without taking the lock, so the
+     * locking policies keep it atomic. SharedReaders says whether read-only
+     * members can run at the same time, and so need their own lock around
+     * any cache they update.
+     */
+
+    /**
+     * ExclusiveLock -- one std::mutex shared by readers and writers alike.
+     *  This is the default, and matches the original behavior.
+     */
+    struct ExclusiveLock
+    {
+        using Mutex = std::mutex;
+        using ReadGuard = std::lock_guard<std::mutex>;
+        using WriteGuard = std::lock_guard<std::mutex>;
+        static constexpr bool SharedReaders = false;
+
+        template <typename U>
+        using Counter = std::atomic<U>;
+    };
+
+    /**
+     * SharedLock -- a std::shared_mutex, so read-only members run in parallel
+     *  while mutating members remain exclusive.
+     */
+    struct SharedLock
+    {
+        using Mutex = std::shared_mutex;
+        using ReadGuard = std::shared_lock<std::shared_mutex>;
+        using WriteGuard = std::unique_lock<std::shared_mutex>;
+        static constexpr bool SharedReaders = true;
+
+        template <typename U>
+        using Counter = std::atomic<U>;
+    };
+
+    /**
+     * NoLock -- no synchronization at all, for single-threaded use.
+     *  Every guard compiles away to nothing.
+     */
+    struct NoLock
+    {
+        struct Mutex
+        {
+            void lock() {}
+            bool try_lock() { return true; }
+            void unlock() {}
+            void lock_shared() {}
+            bool try_lock_shared() { return true; }
+            void unlock_shared() {}
+        };
+
+        struct Guard
+        {
+            explicit Guard(Mutex&) {}
+        };
+
+        using ReadGuard = Guard;
+        using WriteGuard = Guard;
+        static constexpr bool SharedReaders = false;
+
+        template <typename U>
+        using Counter = U;
+    };
+
+    // Guards a cache that read-only members update. A real mutex only when
+    // readers can run together; otherwise the list lock already covers it,
+    // and this compiles away.
+    template <typename LockPolicy>
+    using ReaderCacheMutex = typename std::conditional<LockPolicy::SharedReaders, std::mutex, NoLock::Mutex>::type;
+} // namespace CDS
+
+#endif // CDS_LOCKPOLICY_HPP
@@ -0,0 +1,116 @@
+// =================================================================
+// MappedListView.hpp
+//  Description     Declaration of MappedListView
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_MAPPEDLISTVIEW_HPP
+#define CDS_MAPPEDLISTVIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <libcds/Serialization.hpp>
+#include <string>
+#include <type_traits>
+
+namespace CDS
+{
+    /**
+     * MappedListView - Class to read a saved list in place, without loading it.
+     * Features:
+     *      Maps the file written by a list's Save, read-only
+     *      O(1) Size and indexed access, searched and iterated in place
+     *      Pluggable Serializer, with in-place reads of trivially copyable types
+     *      Safe for any number of concurrent readers
+     *      Destructor
+     *
+     * Opening costs one mapping and a check of the file, not an allocation
+     * per element. Elements come back as Serializer::View (const T& or
+     * std::string_view), which point into the mapping and are only valid
+     * until the view is closed or reopened.
+     */
+    template <typename T, typename S = Serializer<T>>
+    class MappedListView final
+    {
+    public:
+        using View = typename S::View;
+
+    private:
+        MappedFile file;
+        size_t count;
+        const char* records;
+
+        // record offsets, for variable-size records only
+        const uint64_t* offsets;
+
+        View Record(size_t index) const;
+
+    public:
+        // returned when index is not found for indexOf();
+        const size_t npos = static_cast<size_t>(-1);
+
+        // iterates the elements in list order
+        class const_iterator
+        {
+        private:
+            const MappedListView* view;
+            size_t index;
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = View;
+
+            const_iterator() : view(nullptr), index(0) {}
+            const_iterator(const MappedListView* view, size_t index) : view(view), index(index) {}
+
+            reference operator*() const { return view->Record(index); }
+
+            const_iterator& operator++()
+            {
+                index++;
+                return *this;
+            }
+            const_iterator operator++(int)
+            {
+                const_iterator temp = *this;
+                index++;
+                return temp;
+            }
+
+            bool operator==(const const_iterator& other) const { return index == other.index; }
+            bool operator!=(const const_iterator& other) const { return index != other.index; }
+        };
+
+        // default constructor, viewing nothing
+        MappedListView() : count(0), records(nullptr), offsets(nullptr) {}
+
+        // views are not copyable
+        MappedListView(const MappedListView&) = delete;
+        MappedListView& operator=(const MappedListView&) = delete;
+
+        // maps a file written by Save. False, leaving the view empty, if it
+        // can't be read or was not saved from a list of T with S.
+        bool Open(const std::string& path);
+        void Close();
+
+        size_t Size() const { return count; }
+
+        // element at index < Size(), unchecked
+        View operator[](size_t index) const { return Record(index); }
+
+        bool Search(const T& value) const;
+        size_t IndexOf(const T& value) const;
+
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, count); }
+    };
+} // namespace CDS
+
+#include <libcds/MappedListView.tpp>
+
+#endif // CDS_MAPPEDLISTVIEW_HPP
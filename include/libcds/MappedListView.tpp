@@ -0,0 +1,67 @@
+// =================================================================
+// MappedListView.tpp
+//  Description     Implementation of MappedListView
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <libcds/MappedListView.hpp>
+
+template <typename T, typename S>
+bool
+CDS::MappedListView<T, S>::Open(const std::string& path)
+{
+    Close();
+    ListFileHeader header;
+    if (!file.Open(path) || !ValidateListFile<S>(file, header))
+    {
+        file.Close();
+        return false;
+    }
+
+    count = static_cast<size_t>(header.count);
+    records = file.Data() + header.recordsOffset;
+    if constexpr (S::FixedSize == 0)
+        offsets = reinterpret_cast<const uint64_t*>(file.Data() + header.tableOffset);
+    return true;
+}
+
+template <typename T, typename S>
+void
+CDS::MappedListView<T, S>::Close()
+{
+    file.Close();
+    count = 0;
+    records = nullptr;
+    offsets = nullptr;
+}
+
+// finds record index by its fixed size or through the offset table
+template <typename T, typename S>
+typename CDS::MappedListView<T, S>::View
+CDS::MappedListView<T, S>::Record(size_t index) const
+{
+    if constexpr (S::FixedSize != 0)
+        return S::Read(records + index * S::FixedSize, S::FixedSize);
+    else
+        return S::Read(records + offsets[index], static_cast<size_t>(offsets[index + 1] - offsets[index]));
+}
+
+template <typename T, typename S>
+bool
+CDS::MappedListView<T, S>::Search(const T& value) const
+{
+    return IndexOf(value) != npos;
+}
+
+template <typename T, typename S>
+size_t
+CDS::MappedListView<T, S>::IndexOf(const T& value) const
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (Record(i) == value)
+            return i;
+    }
+    return npos;
+}
@@ -0,0 +1,161 @@
+// =================================================================
+// NodePool.hpp
+//  Description     Declaration of NodePool, a slab allocator for nodes
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_NODEPOOL_HPP
+#define CDS_NODEPOOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CDS
+{
+    /**
+     * NodePoolState - The shared, untyped state behind a NodePool.
+     * Features:
+     *      Fixed-size blocks carved out of large slabs
+     *      Striped free-list caches, picked by thread, to keep threads apart
+     *      Release() of every block at once, keeping slabs for reuse
+     *
+     * The block size is fixed by the first single-object allocation. Any
+     * other request (arrays, other sizes, over-aligned types) is not pooled,
+     * and is counted until freed so Release() cannot drop it.
+     */
+    class NodePoolState
+    {
+    public:
+        // number of free-list caches, and blocks carved per slab
+        static constexpr size_t CacheCount = 8;
+        static constexpr size_t BlocksPerSlab = 1024;
+
+        // blocks moved from a slab into a cache on each refill
+        static constexpr size_t RefillCount = 32;
+
+        NodePoolState() : blockSize(0), slabIndex(0), slabOffset(0), unpooled(0) {}
+        ~NodePoolState();
+
+        NodePoolState(const NodePoolState&) = delete;
+        NodePoolState& operator=(const NodePoolState&) = delete;
+
+        // whether a request of this shape is served by the pool
+        bool Accepts(size_t bytes, size_t align, size_t n);
+
+        void* Allocate();
+        void Deallocate(void* p);
+
+        // requests the pool does not accept, from the global heap
+        void* AllocateUnpooled(size_t bytes);
+        void DeallocateUnpooled(void* p);
+
+        // forgets every handed out block in O(CacheCount). Refuses while
+        // unpooled allocations are live, since those would leak.
+        bool Release();
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        struct alignas(64) Cache
+        {
+            std::mutex mtx;
+            FreeBlock* free = nullptr;
+        };
+
+        Cache caches[CacheCount];
+
+        std::mutex slabMtx;
+        std::atomic<size_t> blockSize;
+        std::vector<char*> slabs;
+        size_t slabIndex;
+        size_t slabOffset;
+
+        // live allocations that fell back to the global heap
+        std::atomic<size_t> unpooled;
+
+        static size_t CacheIndex();
+
+        // carves up to count blocks from the slabs into a chain
+        FreeBlock* Carve(size_t count);
+    };
+
+    /**
+     * NodePool - Standard Allocator-compatible front end to NodePoolState.
+     *
+     * Copies (including rebound copies) share one pool. Each default
+     * constructed NodePool owns a fresh pool, so a container built with a
+     * temporary NodePool is the pool's only owner and can Release() it.
+     */
+    template <typename T>
+    class NodePool
+    {
+    private:
+        std::shared_ptr<NodePoolState> state;
+
+        template <typename U>
+        friend class NodePool;
+
+    public:
+        using value_type = T;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = NodePool<U>;
+        };
+
+        NodePool() : state(std::make_shared<NodePoolState>()) {}
+
+        template <typename U>
+        NodePool(const NodePool<U>& other) noexcept : state(other.state)
+        {
+        }
+
+        T* allocate(size_t n);
+        void deallocate(T* p, size_t n) noexcept;
+
+        // drops every block at once. Only succeeds while this allocator is
+        // the pool's sole owner and nothing unpooled is live, and never runs
+        // destructors.
+        bool Release() noexcept;
+
+        template <typename U>
+        bool operator==(const NodePool<U>& other) const noexcept
+        {
+            return state == other.state;
+        }
+
+        template <typename U>
+        bool operator!=(const NodePool<U>& other) const noexcept
+        {
+            return state != other.state;
+        }
+    };
+
+    // detects allocators offering a bulk Release(), such as NodePool
+    template <typename A, typename = void>
+    struct is_releasable_allocator : std::false_type
+    {
+    };
+
+    template <typename A>
+    struct is_releasable_allocator<A, decltype(void(std::declval<A&>().Release()))> : std::true_type
+    {
+    };
+} // namespace CDS
+
+#include <libcds/NodePool.tpp>
+
+#endif // CDS_NODEPOOL_HPP
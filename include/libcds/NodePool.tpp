@@ -0,0 +1,173 @@
+// =================================================================
+// NodePool.tpp
+//  Description     Implementation of NodePool
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <algorithm>
+#include <functional>
+#include <libcds/NodePool.hpp>
+#include <new>
+#include <thread>
+
+// Destructor frees every slab. Blocks need no individual cleanup.
+inline CDS::NodePoolState::~NodePoolState()
+{
+    for (char* slab : slabs)
+        ::operator delete(slab);
+}
+
+// Picks this thread's cache. The hash is computed once per thread.
+inline size_t
+CDS::NodePoolState::CacheIndex()
+{
+    static thread_local size_t index = std::hash<std::thread::id>()(std::this_thread::get_id()) % CacheCount;
+    return index;
+}
+
+inline bool
+CDS::NodePoolState::Accepts(size_t bytes, size_t align, size_t n)
+{
+    if (n != 1 || align > alignof(std::max_align_t))
+        return false;
+
+    // round up so every block stays max-aligned within its slab
+    const size_t a = alignof(std::max_align_t);
+    size_t rounded = (std::max(bytes, sizeof(FreeBlock)) + a - 1) / a * a;
+
+    // the first single-object request fixes the block size
+    size_t expected = 0;
+    if (blockSize.compare_exchange_strong(expected, rounded))
+        return true;
+    return expected == rounded;
+}
+
+inline CDS::NodePoolState::FreeBlock*
+CDS::NodePoolState::Carve(size_t count)
+{
+    std::lock_guard<std::mutex> lock(slabMtx);
+    const size_t bsize = blockSize.load();
+    const size_t slabBytes = bsize * BlocksPerSlab;
+
+    FreeBlock* chain = nullptr;
+    for (size_t i = 0; i < count; ++i)
+    {
+        // move on to the next slab once this one is used up
+        if (slabOffset + bsize > slabBytes)
+        {
+            slabIndex++;
+            slabOffset = 0;
+        }
+        if (slabIndex == slabs.size())
+            slabs.push_back(static_cast<char*>(::operator new(slabBytes)));
+
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(slabs[slabIndex] + slabOffset);
+        slabOffset += bsize;
+        block->next = chain;
+        chain = block;
+    }
+    return chain;
+}
+
+inline void*
+CDS::NodePoolState::Allocate()
+{
+    Cache& cache = caches[CacheIndex()];
+    {
+        std::lock_guard<std::mutex> lock(cache.mtx);
+        if (cache.free)
+        {
+            FreeBlock* block = cache.free;
+            cache.free = block->next;
+            return block;
+        }
+    }
+
+    // cache is empty, refill it from the slabs in one go
+    FreeBlock* chain = Carve(RefillCount);
+    FreeBlock* block = chain;
+    chain = chain->next;
+    if (chain)
+    {
+        FreeBlock* last = chain;
+        while (last->next)
+            last = last->next;
+
+        std::lock_guard<std::mutex> lock(cache.mtx);
+        last->next = cache.free;
+        cache.free = chain;
+    }
+    return block;
+}
+
+inline void
+CDS::NodePoolState::Deallocate(void* p)
+{
+    Cache& cache = caches[CacheIndex()];
+    FreeBlock* block = static_cast<FreeBlock*>(p);
+
+    std::lock_guard<std::mutex> lock(cache.mtx);
+    block->next = cache.free;
+    cache.free = block;
+}
+
+inline void*
+CDS::NodePoolState::AllocateUnpooled(size_t bytes)
+{
+    void* p = ::operator new(bytes);
+    unpooled.fetch_add(1, std::memory_order_relaxed);
+    return p;
+}
+
+inline void
+CDS::NodePoolState::DeallocateUnpooled(void* p)
+{
+    unpooled.fetch_sub(1, std::memory_order_relaxed);
+    ::operator delete(p);
+}
+
+inline bool
+CDS::NodePoolState::Release()
+{
+    if (unpooled.load(std::memory_order_relaxed) != 0)
+        return false;
+
+    std::lock_guard<std::mutex> lock(slabMtx);
+    for (Cache& cache : caches)
+    {
+        std::lock_guard<std::mutex> cacheLock(cache.mtx);
+        cache.free = nullptr;
+    }
+    slabIndex = 0;
+    slabOffset = 0;
+    return true;
+}
+
+template <typename T>
+T*
+CDS::NodePool<T>::allocate(size_t n)
+{
+    if (state->Accepts(sizeof(T), alignof(T), n))
+        return static_cast<T*>(state->Allocate());
+    return static_cast<T*>(state->AllocateUnpooled(n * sizeof(T)));
+}
+
+template <typename T>
+void
+CDS::NodePool<T>::deallocate(T* p, size_t n) noexcept
+{
+    if (state->Accepts(sizeof(T), alignof(T), n))
+        state->Deallocate(p);
+    else
+        state->DeallocateUnpooled(p);
+}
+
+template <typename T>
+bool
+CDS::NodePool<T>::Release() noexcept
+{
+    if (state.use_count() != 1)
+        return false;
+    return state->Release();
+}
@@ -0,0 +1,135 @@
+// =================================================================
+// Serialization.hpp
+//  Description     Declares the list file format and its serializers
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_SERIALIZATION_HPP
+#define CDS_SERIALIZATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <libcds/DataStructure.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace CDS
+{
+    /**
+     * Serializer<T> -- how elements of T are written to and read back from a
+     *  list file. A serializer supplies:
+     *      FixedSize       bytes per element, or 0 for variable-size records
+     *      View            what a read returns, pointing into the file
+     *      Size(value)     bytes value needs
+     *      Write(value, out)   writes those bytes to out
+     *      Read(data, size)    a View of a record
+     *  A list must be constructible from a View, and a View comparable to T.
+     *
+     * Trivially copyable types are stored inline and read in place. Other
+     * types need a specialization, like the one for std::string, or a
+     * serializer passed to Save, Load, and MappedListView explicitly.
+     */
+    template <typename T, typename = void>
+    struct Serializer;
+
+    template <typename T>
+    struct Serializer<T, std::enable_if_t<std::is_trivially_copyable<T>::value>>
+    {
+        static_assert(alignof(T) <= CacheLineSize, "Serializer cannot read types aligned past a cache line in place");
+
+        static constexpr size_t FixedSize = sizeof(T);
+        using View = const T&;
+
+        static size_t Size(const T&) { return sizeof(T); }
+        static void Write(const T& value, char* out) { std::memcpy(out, &value, sizeof(T)); }
+        static View Read(const char* data, size_t) { return *reinterpret_cast<const T*>(data); }
+    };
+
+    template <>
+    struct Serializer<std::string>
+    {
+        static constexpr size_t FixedSize = 0;
+        using View = std::string_view;
+
+        static size_t Size(const std::string& value) { return value.size(); }
+        static void Write(const std::string& value, char* out) { std::memcpy(out, value.data(), value.size()); }
+        static View Read(const char* data, size_t size) { return View(data, size); }
+    };
+
+    // bumped whenever the layout below changes; older files are rejected
+    constexpr uint32_t ListFileVersion = 1;
+
+    /**
+     * ListFileHeader -- starts every list file. Everything after it is found
+     *  by offsets from the start of the file, never by pointers:
+     *      fixed-size elements: count records of recordSize bytes at recordsOffset
+     *      variable-size elements: count + 1 uint64_t offsets at tableOffset,
+     *          record i spanning [offsets[i], offsets[i + 1]) from recordsOffset
+     *  Sections start on cache-line boundaries, so elements can be read in
+     *  place once the file is mapped. Files are in the writer's byte order.
+     */
+    struct ListFileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrder;
+        uint64_t count;
+        uint64_t recordSize;
+        uint64_t tableOffset;
+        uint64_t recordsOffset;
+        uint64_t recordsSize;
+    };
+
+    // "LIBCDSL" and a terminator, and a marker that reads back differently
+    // on a machine of the other byte order
+    constexpr char ListFileMagic[8] = {'L', 'I', 'B', 'C', 'D', 'S', 'L', '\0'};
+    constexpr uint32_t ListFileByteOrder = 0x01020304;
+
+    /**
+     * MappedFile -- a whole file mapped read-only (mmap, or MapViewOfFile on
+     *  Windows), unmapped on Close or destruction.
+     */
+    class MappedFile
+    {
+    private:
+        const char* data;
+        size_t size;
+#ifdef _WIN32
+        void* file;
+        void* mapping;
+#endif
+
+    public:
+        MappedFile();
+        ~MappedFile() { Close(); }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // maps path, closing any earlier mapping first. False if it can't
+        // be opened or is empty.
+        bool Open(const std::string& path);
+        void Close();
+
+        const char* Data() const { return data; }
+        size_t Size() const { return size; }
+    };
+
+    // writes count elements from [first, last) to path in the list format.
+    // The file is written beside path and renamed over it, so a MappedFile
+    // of the old file is never truncated underneath its reader.
+    template <typename S, typename ForwardIt>
+    bool WriteListFile(const std::string& path, ForwardIt first, ForwardIt last, size_t count);
+
+    // checks a mapped list file against S, filling header. Every offset is
+    // bounds-checked, so a corrupt or truncated file is rejected, not read.
+    template <typename S>
+    bool ValidateListFile(const MappedFile& file, ListFileHeader& header);
+} // namespace CDS
+
+#include <libcds/Serialization.tpp>
+
+#endif // CDS_SERIALIZATION_HPP
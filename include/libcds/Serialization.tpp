@@ -0,0 +1,246 @@
+// =================================================================
+// Serialization.tpp
+//  Description     Implementation of the list file format
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <libcds/Serialization.hpp>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+inline CDS::MappedFile::MappedFile() : data(nullptr), size(0), file(INVALID_HANDLE_VALUE), mapping(nullptr)
+{
+}
+
+inline bool
+CDS::MappedFile::Open(const std::string& path)
+{
+    Close();
+    file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER length;
+    if (!GetFileSizeEx(file, &length) || length.QuadPart == 0 || static_cast<uint64_t>(length.QuadPart) > SIZE_MAX)
+    {
+        Close();
+        return false;
+    }
+
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping)
+        data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (data == nullptr)
+    {
+        Close();
+        return false;
+    }
+    size = static_cast<size_t>(length.QuadPart);
+    return true;
+}
+
+inline void
+CDS::MappedFile::Close()
+{
+    if (data)
+        UnmapViewOfFile(data);
+    if (mapping)
+        CloseHandle(mapping);
+    if (file != INVALID_HANDLE_VALUE)
+        CloseHandle(file);
+    data = nullptr;
+    size = 0;
+    mapping = nullptr;
+    file = INVALID_HANDLE_VALUE;
+}
+#else
+inline CDS::MappedFile::MappedFile() : data(nullptr), size(0)
+{
+}
+
+inline bool
+CDS::MappedFile::Open(const std::string& path)
+{
+    Close();
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    // the mapping outlives the descriptor
+    struct stat info;
+    void* mapped = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0)
+        mapped = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+        return false;
+
+    data = static_cast<const char*>(mapped);
+    size = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+inline void
+CDS::MappedFile::Close()
+{
+    if (data)
+        munmap(const_cast<char*>(data), size);
+    data = nullptr;
+    size = 0;
+}
+#endif
+
+// Writes the header, the offset table for variable-size records, then the
+// records, batched through a buffer. Variable-size elements are walked
+// twice, once to size them and once to write them.
+template <typename S, typename ForwardIt>
+bool
+CDS::WriteListFile(const std::string& path, ForwardIt first, ForwardIt last, size_t count)
+{
+    auto alignUp = [](uint64_t offset) { return (offset + CacheLineSize - 1) / CacheLineSize * CacheLineSize; };
+
+    ListFileHeader header = {};
+    std::memcpy(header.magic, ListFileMagic, sizeof(header.magic));
+    header.version = ListFileVersion;
+    header.byteOrder = ListFileByteOrder;
+    header.count = count;
+    header.recordSize = S::FixedSize;
+
+    std::vector<uint64_t> offsets;
+    if constexpr (S::FixedSize != 0)
+    {
+        header.recordsOffset = alignUp(sizeof(ListFileHeader));
+        header.recordsSize = static_cast<uint64_t>(count) * S::FixedSize;
+    }
+    else
+    {
+        offsets.reserve(count + 1);
+        offsets.push_back(0);
+        for (ForwardIt it = first; it != last; ++it)
+            offsets.push_back(offsets.back() + S::Size(*it));
+        if (offsets.size() != count + 1)
+            return false;
+        header.tableOffset = alignUp(sizeof(ListFileHeader));
+        header.recordsOffset = alignUp(header.tableOffset + offsets.size() * sizeof(uint64_t));
+        header.recordsSize = offsets.back();
+    }
+
+    std::string temp = path + ".tmp";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+
+        // zero padding up to the next section
+        uint64_t position = 0;
+        auto padTo = [&](uint64_t offset) {
+            static const char zeros[CacheLineSize] = {};
+            out.write(zeros, static_cast<std::streamsize>(offset - position));
+            position = offset;
+        };
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        position = sizeof(header);
+        if (!offsets.empty())
+        {
+            padTo(header.tableOffset);
+            out.write(reinterpret_cast<const char*>(offsets.data()), static_cast<std::streamsize>(offsets.size() * sizeof(uint64_t)));
+            position += offsets.size() * sizeof(uint64_t);
+        }
+        padTo(header.recordsOffset);
+
+        constexpr size_t BufferSize = 64 * 1024;
+        std::vector<char> buffer;
+        buffer.reserve(BufferSize);
+        size_t written = 0;
+        for (; first != last; ++first, ++written)
+        {
+            size_t bytes = S::Size(*first);
+            size_t at = buffer.size();
+            buffer.resize(at + bytes);
+            if (bytes)
+                S::Write(*first, buffer.data() + at);
+            if (buffer.size() >= BufferSize)
+            {
+                out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+        if (written != count || !out.flush())
+        {
+            out.close();
+            std::remove(temp.c_str());
+            return false;
+        }
+    }
+
+    // rename replaces path atomically on POSIX. Windows refuses to replace
+    // an existing file, so it gets a brief gap instead.
+    if (std::rename(temp.c_str(), path.c_str()) == 0)
+        return true;
+    std::remove(path.c_str());
+    if (std::rename(temp.c_str(), path.c_str()) == 0)
+        return true;
+    std::remove(temp.c_str());
+    return false;
+}
+
+template <typename S>
+bool
+CDS::ValidateListFile(const MappedFile& file, ListFileHeader& header)
+{
+    const uint64_t size = file.Size();
+    if (file.Data() == nullptr || size < sizeof(ListFileHeader))
+        return false;
+    std::memcpy(&header, file.Data(), sizeof(header));
+
+    if (std::memcmp(header.magic, ListFileMagic, sizeof(header.magic)) != 0 || header.version != ListFileVersion ||
+        header.byteOrder != ListFileByteOrder || header.recordSize != S::FixedSize)
+        return false;
+
+    // the records must lie inside the file, on a cache line
+    if (header.recordsOffset % CacheLineSize != 0 || header.recordsOffset > size || header.recordsSize > size - header.recordsOffset)
+        return false;
+
+    if constexpr (S::FixedSize != 0)
+    {
+        return header.recordsSize % S::FixedSize == 0 && header.recordsSize / S::FixedSize == header.count;
+    }
+    else
+    {
+        // count + 1 offsets must fit, rising from 0 to the end of the records
+        if (header.tableOffset % CacheLineSize != 0 || header.tableOffset > size ||
+            header.count >= (size - header.tableOffset) / sizeof(uint64_t))
+            return false;
+
+        const uint64_t* offsets = reinterpret_cast<const uint64_t*>(file.Data() + header.tableOffset);
+        if (offsets[0] != 0 || offsets[header.count] != header.recordsSize)
+            return false;
+        for (uint64_t i = 0; i < header.count; ++i)
+        {
+            if (offsets[i] > offsets[i + 1])
+                return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,65 @@
+// =================================================================
+// Simd.hpp
+//  Description     Declares the runtime-dispatched SIMD search helpers
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_SIMD_HPP
+#define CDS_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CDS_SIMD_X86 1
+#endif
+
+// GCC and Clang need per-function target attributes for wider ISAs,
+// MSVC lets any function use any intrinsic.
+#if defined(__GNUC__) || defined(__clang__)
+#define CDS_SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CDS_SIMD_TARGET(isa)
+#endif
+
+namespace CDS
+{
+    namespace Simd
+    {
+        // instruction set levels, detected once at runtime
+        enum class Level
+        {
+            Scalar,
+            SSE2,
+            AVX2
+        };
+
+        // whether values of T are searched with Find32
+        template <typename T>
+        struct is_searchable
+            : std::integral_constant<bool, sizeof(T) == sizeof(uint32_t)
+                                               && (std::is_same<typename std::remove_cv<T>::type, int>::value
+                                                   || std::is_same<typename std::remove_cv<T>::type, unsigned int>::value)>
+        {
+        };
+
+        // best instruction set the running CPU supports
+        Level Detect();
+
+        // index of the first element equal to value in [data, data + n), or n
+        size_t Find32(const uint32_t* data, size_t n, uint32_t value);
+
+        // the individual implementations, exposed for testing & benchmarking
+        size_t Find32Scalar(const uint32_t* data, size_t n, uint32_t value);
+#ifdef CDS_SIMD_X86
+        size_t Find32SSE2(const uint32_t* data, size_t n, uint32_t value);
+        size_t Find32AVX2(const uint32_t* data, size_t n, uint32_t value);
+#endif
+    } // namespace Simd
+} // namespace CDS
+
+#include <libcds/Simd.tpp>
+
+#endif // CDS_SIMD_HPP
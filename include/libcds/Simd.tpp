@@ -0,0 +1,135 @@
+// =================================================================
+// Simd.tpp
+//  Description     Implementation of the SIMD search helpers
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <libcds/Simd.hpp>
+
+#ifdef CDS_SIMD_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#endif
+
+namespace CDS
+{
+    namespace Simd
+    {
+        // index of the lowest set bit. mask must be non-zero.
+        inline unsigned
+        LowestBit(unsigned mask)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return static_cast<unsigned>(index);
+#else
+            return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+        }
+    } // namespace Simd
+} // namespace CDS
+
+inline CDS::Simd::Level
+CDS::Simd::Detect()
+{
+#if defined(CDS_SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    int maxId = info[0];
+
+    __cpuid(info, 1);
+    bool sse2 = (info[3] & (1 << 26)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+
+    // AVX2 also needs the OS to save the YMM registers
+    if (maxId >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6)
+    {
+        __cpuidex(info, 7, 0);
+        if (info[1] & (1 << 5))
+            return Level::AVX2;
+    }
+    return sse2 ? Level::SSE2 : Level::Scalar;
+#elif defined(CDS_SIMD_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return Level::AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return Level::SSE2;
+    return Level::Scalar;
+#else
+    return Level::Scalar;
+#endif
+}
+
+inline size_t
+CDS::Simd::Find32Scalar(const uint32_t* data, size_t n, uint32_t value)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (data[i] == value)
+            return i;
+    }
+    return n;
+}
+
+#ifdef CDS_SIMD_X86
+// compares 4 lanes at a time, finishing the tail with the scalar loop
+CDS_SIMD_TARGET("sse2") inline size_t
+CDS::Simd::Find32SSE2(const uint32_t* data, size_t n, uint32_t value)
+{
+    const __m128i needle = _mm_set1_epi32(static_cast<int>(value));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle))));
+        if (mask)
+            return i + LowestBit(mask);
+    }
+    return i + Find32Scalar(data + i, n - i, value);
+}
+
+// compares 8 lanes at a time, finishing the tail with the scalar loop
+CDS_SIMD_TARGET("avx2") inline size_t
+CDS::Simd::Find32AVX2(const uint32_t* data, size_t n, uint32_t value)
+{
+    const __m256i needle = _mm256_set1_epi32(static_cast<int>(value));
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle))));
+        if (mask)
+            return i + LowestBit(mask);
+    }
+    return i + Find32Scalar(data + i, n - i, value);
+}
+#endif
+
+// dispatches to the widest implementation, chosen on first use
+inline size_t
+CDS::Simd::Find32(const uint32_t* data, size_t n, uint32_t value)
+{
+    using FindFn = size_t (*)(const uint32_t*, size_t, uint32_t);
+    static const FindFn fn = []() -> FindFn
+    {
+#ifdef CDS_SIMD_X86
+        switch (Detect())
+        {
+        case Level::AVX2:
+            return &Find32AVX2;
+        case Level::SSE2:
+            return &Find32SSE2;
+        default:
+            break;
+        }
+#endif
+        return &Find32Scalar;
+    }();
+    return fn(data, n, value);
+}
@@ -0,0 +1,270 @@
+// =================================================================
+// Stats.hpp
+//  Description     Declares the opt-in container statistics
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_STATS_HPP
+#define CDS_STATS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <libcds/DataStructure.hpp>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Statistics are compiled in only when CDS_ENABLE_STATS is defined (the
+ * LIBCDS_ENABLE_STATS CMake option). Without it the counters, the counted
+ * mutex, and every CDS_STAT hook disappear (the count expression is not
+ * evaluated), and Stats() returns zeros.
+ * Every translation unit in a program must agree on the setting.
+ */
+#ifdef CDS_ENABLE_STATS
+#define CDS_STAT(stat, n) stats.Add(static_cast<size_t>(::CDS::Stat::stat), (n))
+#else
+#define CDS_STAT(stat, n) ((void)sizeof(n))
+#endif
+
+namespace CDS
+{
+    // what a list counts. Lookups are finds by value (Search, Remove, ...),
+    // seeks are walks to an index (Get, positional inserts), and steps are
+    // the nodes each of those walked.
+    enum class Stat : size_t
+    {
+        Inserts,
+        Searches,
+        Removes,
+        Gets,
+        IndexOfs,
+        Clears,
+        Lookups,
+        LookupSteps,
+        IndexOfSteps,
+        Seeks,
+        SeekSteps,
+        Allocations,
+        Deallocations,
+        LockAcquisitions,
+        LockContentions,
+        LockWaitNanoseconds,
+        Count
+    };
+
+    constexpr size_t StatCount = static_cast<size_t>(Stat::Count);
+
+    /**
+     * ListStats -- point-in-time totals for one list, summed over threads.
+     */
+    struct ListStats
+    {
+        uint64_t values[StatCount] = {};
+
+        uint64_t operator[](Stat stat) const { return values[static_cast<size_t>(stat)]; }
+
+        // mean nodes walked per call, or 0 before the first call
+        double AverageLookupLength() const { return Ratio(Stat::LookupSteps, Stat::Lookups); }
+        double AverageIndexOfLength() const { return Ratio(Stat::IndexOfSteps, Stat::IndexOfs); }
+        double AverageSeekLength() const { return Ratio(Stat::SeekSteps, Stat::Seeks); }
+
+    private:
+        double Ratio(Stat steps, Stat calls) const
+        {
+            return (*this)[calls] ? static_cast<double>((*this)[steps]) / static_cast<double>((*this)[calls]) : 0.0;
+        }
+    };
+
+    // counters are spread over this many cache lines, one picked per thread
+    constexpr size_t StatStripes = 8;
+
+    // this thread's stripe, assigned round-robin on first use
+    size_t StatStripe();
+
+    /**
+     * StripedCounters -- Fields counters, kept once per stripe so threads
+     *  rarely share a cache line. Adds are relaxed; reads sum the stripes.
+     */
+    template <size_t Fields>
+    class StripedCounters
+    {
+    private:
+        struct alignas(CacheLineSize) Stripe
+        {
+            std::atomic<uint64_t> values[Fields];
+        };
+
+        Stripe stripes[StatStripes];
+
+    public:
+        StripedCounters() { Reset(); }
+        StripedCounters(const StripedCounters&) = delete;
+        StripedCounters& operator=(const StripedCounters&) = delete;
+
+        void Add(size_t field, uint64_t n) { stripes[StatStripe()].values[field].fetch_add(n, std::memory_order_relaxed); }
+        uint64_t Sum(size_t field) const;
+        void Reset();
+    };
+
+    /**
+     * CountedMutex -- wraps a mutex, counting acquisitions and timing the
+     *  waits. An uncontended lock costs one try_lock and one add; the clock
+     *  is only read when try_lock fails.
+     */
+    template <typename M>
+    class CountedMutex
+    {
+    private:
+        enum Field
+        {
+            Acquired,
+            Contended,
+            WaitNanoseconds,
+            FieldCount
+        };
+
+        M mutex;
+        StripedCounters<FieldCount> counters;
+
+        template <typename TryLock, typename Lock>
+        void Acquire(TryLock tryLock, Lock lock);
+
+    public:
+        void lock();
+        bool try_lock();
+        void unlock() { mutex.unlock(); }
+
+        void lock_shared();
+        bool try_lock_shared();
+        void unlock_shared() { mutex.unlock_shared(); }
+
+        // adds the lock counters into stats
+        void ReadInto(ListStats& stats) const;
+        void Reset() { counters.Reset(); }
+    };
+
+    // lock counters of a list's mutex. Mutexes that are not counted add nothing.
+    template <typename M>
+    void ReadLockStats(const M&, ListStats&)
+    {
+    }
+    template <typename M>
+    void ReadLockStats(const CountedMutex<M>& mutex, ListStats& stats)
+    {
+        mutex.ReadInto(stats);
+    }
+
+    template <typename M>
+    void ResetLockStats(M&)
+    {
+    }
+    template <typename M>
+    void ResetLockStats(CountedMutex<M>& mutex)
+    {
+        mutex.Reset();
+    }
+
+    // Guard<OldMutex> as Guard<Mutex>, for guards templated on their mutex
+    template <typename Guard, typename Mutex>
+    struct RebindGuard
+    {
+    };
+    template <template <typename> class Guard, typename Old, typename Mutex>
+    struct RebindGuard<Guard<Old>, Mutex>
+    {
+        using type = Guard<Mutex>;
+    };
+
+    /**
+     * CountedLock -- LockPolicy with its mutex swapped for a CountedMutex.
+     *  Policies whose guards cannot be rebound (NoLock) are left as they are.
+     */
+    template <typename LockPolicy, typename = void>
+    struct CountedLock : LockPolicy
+    {
+    };
+
+    template <typename LockPolicy>
+    struct CountedLock<LockPolicy,
+                       std::void_t<typename RebindGuard<typename LockPolicy::ReadGuard, void>::type,
+                                   typename RebindGuard<typename LockPolicy::WriteGuard, void>::type>>
+    {
+        using Mutex = CountedMutex<typename LockPolicy::Mutex>;
+        using ReadGuard = typename RebindGuard<typename LockPolicy::ReadGuard, Mutex>::type;
+        using WriteGuard = typename RebindGuard<typename LockPolicy::WriteGuard, Mutex>::type;
+        static constexpr bool SharedReaders = LockPolicy::SharedReaders;
+
+        template <typename U>
+        using Counter = typename LockPolicy::template Counter<U>;
+    };
+
+    // the policy a list locks its own mutex with
+#ifdef CDS_ENABLE_STATS
+    template <typename LockPolicy>
+    using StatsLock = CountedLock<LockPolicy>;
+#else
+    template <typename LockPolicy>
+    using StatsLock = LockPolicy;
+#endif
+
+    // anything that takes a list's snapshots, such as a PrometheusTextSink
+    using StatsSinkFn = std::function<void(const std::string&, const ListStats&)>;
+
+    /**
+     * StatsSink -- the named sink a list pushes its snapshots to. Safe to
+     *  Set while other threads take snapshots.
+     */
+    class StatsSink
+    {
+    private:
+        mutable std::mutex mtx;
+        std::string name;
+        StatsSinkFn sink;
+
+    public:
+        // an empty fn detaches the sink
+        void Set(std::string listName, StatsSinkFn fn);
+
+        // passes stats to the sink under the list's name, if one is set
+        void Emit(const ListStats& stats) const;
+    };
+
+    // writes the lists in Prometheus text exposition format, one label per list
+    void WritePrometheus(std::ostream& os, const std::vector<std::pair<std::string, ListStats>>& lists);
+
+    /**
+     * PrometheusTextSink -- collects snapshots by list name and writes them
+     *  to a file for a textfile collector. Any callable taking
+     *  (const std::string&, const ListStats&) can stand in for it. Attach
+     *  it to a list with SetStatsSink(name, std::ref(sink)), or call it
+     *  with Stats() snapshots directly.
+     */
+    class PrometheusTextSink
+    {
+    private:
+        std::string path;
+        std::mutex mtx;
+        std::vector<std::pair<std::string, ListStats>> lists;
+
+    public:
+        explicit PrometheusTextSink(std::string path) : path(std::move(path)) {}
+
+        // records a snapshot, replacing any earlier one for the same list
+        void operator()(const std::string& list, const ListStats& stats);
+
+        // writes every list to a temporary file, then renames it over path,
+        // so readers never see half a file. False if the file can't be written.
+        bool Flush();
+    };
+} // namespace CDS
+
+#include <libcds/Stats.tpp>
+
+#endif // CDS_STATS_HPP
@@ -0,0 +1,237 @@
+// =================================================================
+// Stats.tpp
+//  Description     Implementation of the opt-in container statistics
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <libcds/Stats.hpp>
+
+inline size_t
+CDS::StatStripe()
+{
+    static std::atomic<size_t> next(0);
+    thread_local size_t stripe = next.fetch_add(1, std::memory_order_relaxed) % StatStripes;
+    return stripe;
+}
+
+template <size_t Fields>
+uint64_t
+CDS::StripedCounters<Fields>::Sum(size_t field) const
+{
+    uint64_t total = 0;
+    for (const Stripe& stripe : stripes)
+        total += stripe.values[field].load(std::memory_order_relaxed);
+    return total;
+}
+
+template <size_t Fields>
+void
+CDS::StripedCounters<Fields>::Reset()
+{
+    for (Stripe& stripe : stripes)
+    {
+        for (std::atomic<uint64_t>& value : stripe.values)
+            value.store(0, std::memory_order_relaxed);
+    }
+}
+
+template <typename M>
+template <typename TryLock, typename Lock>
+void
+CDS::CountedMutex<M>::Acquire(TryLock tryLock, Lock lock)
+{
+    if (tryLock())
+    {
+        counters.Add(Acquired, 1);
+        return;
+    }
+
+    // the wait is counted as it starts, so it shows while still blocked
+    counters.Add(Contended, 1);
+    auto start = std::chrono::steady_clock::now();
+    lock();
+    auto waited = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    counters.Add(Acquired, 1);
+    counters.Add(WaitNanoseconds, static_cast<uint64_t>(waited.count()));
+}
+
+template <typename M>
+void
+CDS::CountedMutex<M>::lock()
+{
+    Acquire([this]() { return mutex.try_lock(); }, [this]() { mutex.lock(); });
+}
+
+template <typename M>
+bool
+CDS::CountedMutex<M>::try_lock()
+{
+    if (!mutex.try_lock())
+        return false;
+    counters.Add(Acquired, 1);
+    return true;
+}
+
+template <typename M>
+void
+CDS::CountedMutex<M>::lock_shared()
+{
+    Acquire([this]() { return mutex.try_lock_shared(); }, [this]() { mutex.lock_shared(); });
+}
+
+template <typename M>
+bool
+CDS::CountedMutex<M>::try_lock_shared()
+{
+    if (!mutex.try_lock_shared())
+        return false;
+    counters.Add(Acquired, 1);
+    return true;
+}
+
+template <typename M>
+void
+CDS::CountedMutex<M>::ReadInto(ListStats& stats) const
+{
+    stats.values[static_cast<size_t>(Stat::LockAcquisitions)] += counters.Sum(Acquired);
+    stats.values[static_cast<size_t>(Stat::LockContentions)] += counters.Sum(Contended);
+    stats.values[static_cast<size_t>(Stat::LockWaitNanoseconds)] += counters.Sum(WaitNanoseconds);
+}
+
+namespace CDS
+{
+    // escapes a label value per the exposition format
+    inline std::string
+    PrometheusLabel(const std::string& value)
+    {
+        std::string escaped;
+        for (char c : value)
+        {
+            if (c == '\\' || c == '"')
+                escaped += '\\';
+            if (c == '\n')
+            {
+                escaped += "\\n";
+                continue;
+            }
+            escaped += c;
+        }
+        return escaped;
+    }
+} // namespace CDS
+
+// Each metric family is written once, with a sample per list (and per op
+// where there is one), as the format requires.
+inline void
+CDS::WritePrometheus(std::ostream& os, const std::vector<std::pair<std::string, ListStats>>& lists)
+{
+    struct Sample
+    {
+        Stat stat;
+        const char* op;
+    };
+    struct Family
+    {
+        const char* name;
+        const char* help;
+        std::vector<Sample> samples;
+    };
+
+    const Family families[] = {
+        {"cds_list_operations_total",
+         "Calls to each list operation.",
+         {{Stat::Inserts, "insert"}, {Stat::Searches, "search"}, {Stat::Removes, "remove"}, {Stat::Gets, "get"}, {Stat::IndexOfs, "index_of"}, {Stat::Clears, "clear"}}},
+        {"cds_list_nodes_walked_total",
+         "Nodes walked by each kind of traversal.",
+         {{Stat::LookupSteps, "lookup"}, {Stat::IndexOfSteps, "index_of"}, {Stat::SeekSteps, "seek"}}},
+        {"cds_list_lookups_total", "Finds by value, by Search, Remove, and the like.", {{Stat::Lookups, nullptr}}},
+        {"cds_list_seeks_total", "Walks to an index, by Get and positional inserts.", {{Stat::Seeks, nullptr}}},
+        {"cds_list_allocations_total", "Nodes allocated.", {{Stat::Allocations, nullptr}}},
+        {"cds_list_deallocations_total", "Nodes freed.", {{Stat::Deallocations, nullptr}}},
+        {"cds_list_lock_acquisitions_total", "Times the list lock was taken.", {{Stat::LockAcquisitions, nullptr}}},
+        {"cds_list_lock_contentions_total", "Times the list lock was taken only after waiting.", {{Stat::LockContentions, nullptr}}},
+    };
+
+    for (const Family& family : families)
+    {
+        os << "# HELP " << family.name << ' ' << family.help << '\n';
+        os << "# TYPE " << family.name << " counter\n";
+        for (const auto& list : lists)
+        {
+            for (const Sample& sample : family.samples)
+            {
+                os << family.name << "{list=\"" << PrometheusLabel(list.first) << '"';
+                if (sample.op)
+                    os << ",op=\"" << sample.op << '"';
+                os << "} " << list.second[sample.stat] << '\n';
+            }
+        }
+    }
+
+    // wait time is exposed in seconds, per Prometheus convention
+    os << "# HELP cds_list_lock_wait_seconds_total Time spent waiting for the list lock.\n";
+    os << "# TYPE cds_list_lock_wait_seconds_total counter\n";
+    for (const auto& list : lists)
+    {
+        os << "cds_list_lock_wait_seconds_total{list=\"" << PrometheusLabel(list.first) << "\"} "
+           << static_cast<double>(list.second[Stat::LockWaitNanoseconds]) / 1e9 << '\n';
+    }
+}
+
+inline void
+CDS::StatsSink::Set(std::string listName, StatsSinkFn fn)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    name = std::move(listName);
+    sink = std::move(fn);
+}
+
+// Calls under the lock, so Set never swaps the sink out mid-call.
+inline void
+CDS::StatsSink::Emit(const ListStats& stats) const
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    if (sink)
+        sink(name, stats);
+}
+
+inline void
+CDS::PrometheusTextSink::operator()(const std::string& list, const ListStats& stats)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto& entry : lists)
+    {
+        if (entry.first == list)
+        {
+            entry.second = stats;
+            return;
+        }
+    }
+    lists.emplace_back(list, stats);
+}
+
+inline bool
+CDS::PrometheusTextSink::Flush()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    std::string temp = path + ".tmp";
+    {
+        std::ofstream out(temp, std::ios::trunc);
+        if (!out)
+            return false;
+        WritePrometheus(out, lists);
+        if (!out.flush())
+            return false;
+    }
+
+    // rename replaces path atomically on POSIX. Windows refuses to replace
+    // an existing file, so it gets a brief gap instead.
+    if (std::rename(temp.c_str(), path.c_str()) == 0)
+        return true;
+    std::remove(path.c_str());
+    return std::rename(temp.c_str(), path.c_str()) == 0;
+}
@@ -0,0 +1,98 @@
+// =================================================================
+// ThreadPool.hpp
+//  Description     Declaration of the work-stealing ThreadPool
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_THREADPOOL_HPP
+#define CDS_THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <libcds/DataStructure.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CDS
+{
+    /**
+     * ThreadPool - Small work-stealing pool behind the parallel list algorithms.
+     * Features:
+     *      One task deque per worker; owners pop the newest task, thieves the oldest
+     *      Fork-join ParallelFor, which the calling thread helps run
+     *      Nested ParallelFor from inside a task, without deadlock
+     *      Idle workers sleep until work arrives
+     *      Destructor
+     *
+     * A thread waiting in ParallelFor runs queued tasks rather than blocking,
+     * so tasks must not wait on locks held by other tasks' callers. The list
+     * algorithms take their locks before calling in, never inside a task.
+     */
+    class ThreadPool final
+    {
+    private:
+        using Task = std::function<void()>;
+
+        struct alignas(CacheLineSize) Queue
+        {
+            std::mutex mtx;
+            std::deque<Task> tasks;
+        };
+
+        // worker count, fixed before any worker starts
+        const size_t threadCount;
+
+        // one queue per worker, plus one shared by threads outside the pool
+        std::unique_ptr<Queue[]> queues;
+        std::vector<std::thread> workers;
+
+        // tasks queued but not yet taken, for waking and sleeping workers
+        std::atomic<size_t> pending;
+        std::mutex sleepMtx;
+        std::condition_variable wake;
+        bool stopping;
+
+        // the queue this thread pushes to and pops from first
+        size_t Home() const;
+
+        void Push(size_t queue, Task task);
+
+        // runs one task from queue, or stolen from another. False if none.
+        bool RunOne(size_t queue);
+
+        void WorkerLoop(size_t index);
+
+    public:
+        // starts threads workers; the caller of ParallelFor makes one more
+        explicit ThreadPool(size_t threads);
+
+        // destructor
+        ~ThreadPool();
+
+        // pools are not copyable
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // worker threads, not counting callers
+        size_t Size() const { return threadCount; }
+
+        // calls fn(i) for each i in [0, count), spread over the pool and the
+        // calling thread, and returns once all are done. The first exception
+        // thrown by fn is rethrown here, after the rest have finished.
+        template <typename Fn>
+        void ParallelFor(size_t count, Fn fn);
+
+        // shared pool, with a worker for each hardware thread but the caller's
+        static ThreadPool& Default();
+    };
+} // namespace CDS
+
+#include <libcds/ThreadPool.tpp>
+
+#endif // CDS_THREADPOOL_HPP
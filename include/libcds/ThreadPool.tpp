@@ -0,0 +1,171 @@
+// =================================================================
+// ThreadPool.tpp
+//  Description     Implementation of the work-stealing ThreadPool
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <algorithm>
+#include <exception>
+#include <libcds/ThreadPool.hpp>
+
+namespace CDS
+{
+    // the pool and queue of the current worker thread, if it is one
+    struct ThreadPoolWorker
+    {
+        const ThreadPool* pool = nullptr;
+        size_t index = 0;
+    };
+
+    inline ThreadPoolWorker&
+    CurrentThreadPoolWorker()
+    {
+        static thread_local ThreadPoolWorker worker;
+        return worker;
+    }
+} // namespace CDS
+
+inline CDS::ThreadPool::ThreadPool(size_t threads) : threadCount(threads), queues(new Queue[threads + 1]), pending(0), stopping(false)
+{
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i)
+        workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+}
+
+inline CDS::ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMtx);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+inline size_t
+CDS::ThreadPool::Home() const
+{
+    const ThreadPoolWorker& worker = CurrentThreadPoolWorker();
+    return worker.pool == this ? worker.index : threadCount;
+}
+
+// The count goes up before the sleep lock is taken, so a worker checking it
+// under that lock either sees the task or is already waiting to be notified.
+inline void
+CDS::ThreadPool::Push(size_t queue, Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(queues[queue].mtx);
+        queues[queue].tasks.push_back(std::move(task));
+    }
+    pending.fetch_add(1, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(sleepMtx);
+    }
+    wake.notify_one();
+}
+
+inline bool
+CDS::ThreadPool::RunOne(size_t queue)
+{
+    Task task;
+    size_t queueCount = threadCount + 1;
+    for (size_t i = 0; i < queueCount && !task; ++i)
+    {
+        // own queue newest first, for locality; others oldest first, which
+        // are the largest pieces of work
+        Queue& victim = queues[(queue + i) % queueCount];
+        std::lock_guard<std::mutex> lock(victim.mtx);
+        if (victim.tasks.empty())
+            continue;
+        if (i == 0)
+        {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+        }
+    }
+    if (!task)
+        return false;
+
+    pending.fetch_sub(1, std::memory_order_relaxed);
+    task();
+    return true;
+}
+
+inline void
+CDS::ThreadPool::WorkerLoop(size_t index)
+{
+    ThreadPoolWorker& worker = CurrentThreadPoolWorker();
+    worker.pool = this;
+    worker.index = index;
+
+    while (true)
+    {
+        if (RunOne(index))
+            continue;
+
+        std::unique_lock<std::mutex> lock(sleepMtx);
+        wake.wait(lock, [this]() { return stopping || pending.load(std::memory_order_acquire) != 0; });
+        if (stopping && pending.load(std::memory_order_acquire) == 0)
+            return;
+    }
+}
+
+// Queues every index but the first, runs the first here, then helps with
+// whatever is queued until the rest are done.
+template <typename Fn>
+void
+CDS::ThreadPool::ParallelFor(size_t count, Fn fn)
+{
+    if (count == 0)
+        return;
+    if (count == 1 || threadCount == 0)
+    {
+        for (size_t i = 0; i < count; ++i)
+            fn(i);
+        return;
+    }
+
+    std::atomic<size_t> remaining(count);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    auto run = [&](size_t i) {
+        try
+        {
+            fn(i);
+        }
+        catch (...)
+        {
+            if (!failed.exchange(true))
+                error = std::current_exception();
+        }
+        remaining.fetch_sub(1, std::memory_order_acq_rel);
+    };
+
+    size_t home = Home();
+    for (size_t i = 1; i < count; ++i)
+        Push(home, [&run, i]() { run(i); });
+    run(0);
+
+    while (remaining.load(std::memory_order_acquire) != 0)
+    {
+        if (!RunOne(home))
+            std::this_thread::yield();
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+inline CDS::ThreadPool&
+CDS::ThreadPool::Default()
+{
+    static ThreadPool pool(std::max<size_t>(std::thread::hardware_concurrency(), 1) - 1);
+    return pool;
+}
@@ -0,0 +1,105 @@
+// =================================================================
+// UnrolledLinkedList.hpp
+//  Description     Declaration of UnrolledLinkedList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDS_UNROLLEDLINKEDLIST_HPP
+#define CDS_UNROLLEDLINKEDLIST_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <libcds/DataStructure.hpp>
+#include <libcds/Simd.hpp>
+#include <mutex>
+#include <new>
+#include <util.hpp>
+
+namespace CDS
+{
+    /**
+     * UnrolledLinkedList - Class to create an unrolled (chunked) linked list.
+     * Features:
+     *      Templated data type
+     *      Thread safe using mutexes
+     *      Each node holds a fixed-capacity array of elements, NodeBytes long
+     *      SIMD search for 32-bit integers (SSE2/AVX2, detected at runtime)
+     *      List operations (insert, indexOf, remove, print, etc.)
+     *      Destructor
+     *
+     * Scans run over contiguous arrays instead of chasing one pointer per
+     * element. Full nodes are split in half on insert, and a node that
+     * drops below half full is merged with its successor when both fit.
+     */
+    template <typename T, size_t NodeBytes = 4 * CacheLineSize>
+    class UnrolledLinkedList final : IList<T>
+    {
+        static_assert(CdsUtil::has_operator_equal<T>::value, "UnrolledLinkedList requires T to have an == operator");
+
+    private:
+        // bytes of bookkeeping at the front of each node
+        static constexpr size_t HeaderBytes = sizeof(void*) + sizeof(size_t);
+
+    public:
+        // elements held per node. Split needs two to leave one on each side,
+        // so a NodeBytes too small for two elements is rounded up.
+        static constexpr size_t Capacity =
+            NodeBytes >= HeaderBytes + 2 * sizeof(T) ? (NodeBytes - HeaderBytes) / sizeof(T) : 2;
+
+    private:
+        struct alignas(CacheLineSize) Node
+        {
+            Node* next;
+            size_t count;
+            alignas(T) unsigned char storage[Capacity * sizeof(T)];
+
+            Node() : next(nullptr), count(0) {}
+
+            T* Items() { return std::launder(reinterpret_cast<T*>(storage)); }
+        };
+
+        Node* head;
+        size_t size;
+        mutable std::mutex mtx;
+
+        // destroys a node's elements, then the node
+        static void DestroyNode(Node* node);
+
+        // offset of the first match within node, or node->count
+        static size_t FindInNode(Node* node, const T& value);
+
+        // moves the upper half of node into a new successor
+        static Node* Split(Node* node);
+
+        // absorbs node->next into node when both fit
+        static void MergeNext(Node* node);
+
+    public:
+        // returned when index is not found for indexOf();
+        const size_t npos = static_cast<size_t>(-1);
+
+        // default constructor
+        UnrolledLinkedList() : head(nullptr), size(0) {}
+
+        // destructor
+        virtual ~UnrolledLinkedList();
+
+        // IDataStructure members
+        virtual bool Search(const T& value) override;
+        virtual void Print() override;
+        virtual bool Remove(const T& value) override;
+        virtual void Clear() override;
+        virtual size_t Size() override;
+
+        // IList members
+        virtual size_t IndexOf(const T& value) override;
+        virtual bool Insert(const T& value) override;
+        virtual bool Insert(const T& value, size_t index) override;
+        virtual T* Get(size_t index) override;
+    };
+} // namespace CDS
+
+#include <libcds/UnrolledLinkedList.tpp>
+
+#endif // CDS_UNROLLEDLINKEDLIST_HPP
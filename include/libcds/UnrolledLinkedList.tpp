@@ -0,0 +1,287 @@
+// =================================================================
+// UnrolledLinkedList.tpp
+//  Description     Template Implementation of UnrolledLinkedList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <libcds/UnrolledLinkedList.hpp>
+#include <utility>
+
+// Destructor deletes each node in the list.
+template <typename T, size_t NodeBytes>
+CDS::UnrolledLinkedList<T, NodeBytes>::~UnrolledLinkedList()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    while (head)
+    {
+        Node* temp = head;
+        head = head->next;
+        DestroyNode(temp);
+    }
+}
+
+template <typename T, size_t NodeBytes>
+void
+CDS::UnrolledLinkedList<T, NodeBytes>::DestroyNode(Node* node)
+{
+    T* items = node->Items();
+    for (size_t i = 0; i < node->count; ++i)
+        items[i].~T();
+    delete node;
+}
+
+// Searches one node's array, with SIMD when T allows it.
+template <typename T, size_t NodeBytes>
+size_t
+CDS::UnrolledLinkedList<T, NodeBytes>::FindInNode(Node* node, const T& value)
+{
+    T* items = node->Items();
+    if constexpr (Simd::is_searchable<T>::value)
+    {
+        return Simd::Find32(reinterpret_cast<const uint32_t*>(items), node->count, static_cast<uint32_t>(value));
+    }
+    else
+    {
+        for (size_t i = 0; i < node->count; ++i)
+        {
+            if (items[i] == value)
+                return i;
+        }
+        return node->count;
+    }
+}
+
+template <typename T, size_t NodeBytes>
+typename CDS::UnrolledLinkedList<T, NodeBytes>::Node*
+CDS::UnrolledLinkedList<T, NodeBytes>::Split(Node* node)
+{
+    Node* right = new Node();
+    T* from = node->Items();
+    T* to = right->Items();
+
+    // move the upper half over
+    size_t half = node->count / 2;
+    for (size_t i = half; i < node->count; ++i)
+    {
+        new (&to[i - half]) T(std::move(from[i]));
+        from[i].~T();
+    }
+    right->count = node->count - half;
+    node->count = half;
+
+    // link it in after node
+    right->next = node->next;
+    node->next = right;
+    return right;
+}
+
+template <typename T, size_t NodeBytes>
+void
+CDS::UnrolledLinkedList<T, NodeBytes>::MergeNext(Node* node)
+{
+    Node* next = node->next;
+    if (next == nullptr || node->count + next->count > Capacity)
+        return;
+
+    T* from = next->Items();
+    T* to = node->Items();
+    for (size_t i = 0; i < next->count; ++i)
+    {
+        new (&to[node->count + i]) T(std::move(from[i]));
+        from[i].~T();
+    }
+    node->count += next->count;
+    node->next = next->next;
+    delete next;
+}
+
+// Searches for $value in the list.
+template <typename T, size_t NodeBytes>
+bool
+CDS::UnrolledLinkedList<T, NodeBytes>::Search(const T& value)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    for (Node* current = head; current; current = current->next)
+    {
+        if (FindInNode(current, value) != current->count)
+            return true;
+    }
+    return false;
+}
+
+// Retrieves value at index. Skips whole nodes at a time.
+template <typename T, size_t NodeBytes>
+T*
+CDS::UnrolledLinkedList<T, NodeBytes>::Get(size_t index)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    // check if index is in range
+    if (index >= size)
+        return nullptr;
+
+    Node* current = head;
+    while (index >= current->count)
+    {
+        index -= current->count;
+        current = current->next;
+    }
+    return &current->Items()[index];
+}
+
+// Searches for value. If found, returns its index. If not found, returns npos.
+template <typename T, size_t NodeBytes>
+size_t
+CDS::UnrolledLinkedList<T, NodeBytes>::IndexOf(const T& value)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t index = 0;
+    for (Node* current = head; current; current = current->next)
+    {
+        size_t offset = FindInNode(current, value);
+        if (offset != current->count)
+            return index + offset;
+        index += current->count;
+    }
+    return npos;
+}
+
+// Inserts to the beginning of the list.
+template <typename T, size_t NodeBytes>
+bool
+CDS::UnrolledLinkedList<T, NodeBytes>::Insert(const T& value)
+{
+    return Insert(value, 0);
+}
+
+template <typename T, size_t NodeBytes>
+bool
+CDS::UnrolledLinkedList<T, NodeBytes>::Insert(const T& value, size_t index)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+
+    // Report failure if index > size
+    if (index > size)
+        return false;
+
+    // list is empty
+    if (head == nullptr)
+        head = new Node();
+
+    // find the node holding index, preferring the end of a node over the
+    // front of its successor
+    Node* current = head;
+    while (index > current->count)
+    {
+        index -= current->count;
+        current = current->next;
+    }
+
+    // make room if the node is full
+    if (current->count == Capacity)
+    {
+        Node* right = Split(current);
+        if (index > current->count)
+        {
+            index -= current->count;
+            current = right;
+        }
+    }
+
+    // shift the tail of the array up by one, then place value
+    T* items = current->Items();
+    if (index == current->count)
+    {
+        new (&items[index]) T(value);
+    }
+    else
+    {
+        new (&items[current->count]) T(std::move(items[current->count - 1]));
+        for (size_t i = current->count - 1; i > index; --i)
+            items[i] = std::move(items[i - 1]);
+        items[index] = value;
+    }
+    current->count++;
+
+    // insertion was successful. increment size & indicate success
+    size++;
+    return true;
+}
+
+// prints the list, separated by spaces
+template <typename T, size_t NodeBytes>
+void
+CDS::UnrolledLinkedList<T, NodeBytes>::Print()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    for (Node* current = head; current; current = current->next)
+    {
+        T* items = current->Items();
+        for (size_t i = 0; i < current->count; ++i)
+            std::cout << items[i] << " ";
+    }
+    std::cout << std::endl;
+}
+
+// removes the specified value. This removes the first value found, not all instances.
+template <typename T, size_t NodeBytes>
+bool
+CDS::UnrolledLinkedList<T, NodeBytes>::Remove(const T& value)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    Node* prev = nullptr;
+    for (Node* current = head; current; prev = current, current = current->next)
+    {
+        size_t offset = FindInNode(current, value);
+        if (offset == current->count)
+            continue;
+
+        // close the gap
+        T* items = current->Items();
+        for (size_t i = offset; i + 1 < current->count; ++i)
+            items[i] = std::move(items[i + 1]);
+        items[current->count - 1].~T();
+        current->count--;
+
+        // unlink emptied nodes, and keep the rest at least half full
+        if (current->count == 0)
+        {
+            if (prev)
+                prev->next = current->next;
+            else
+                head = current->next;
+            delete current;
+        }
+        else if (current->count < Capacity / 2)
+        {
+            MergeNext(current);
+        }
+
+        size--;
+        return true;
+    }
+    return false;
+}
+
+template <typename T, size_t NodeBytes>
+void
+CDS::UnrolledLinkedList<T, NodeBytes>::Clear()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    while (head)
+    {
+        Node* temp = head;
+        head = head->next;
+        DestroyNode(temp);
+    }
+    size = 0;
+}
+
+template <typename T, size_t NodeBytes>
+size_t
+CDS::UnrolledLinkedList<T, NodeBytes>::Size()
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    return size;
+}
@@ -6,7 +6,12 @@
 #include <cassert>
 #include <chrono>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
 #include <stdarg.h>
+#include <string>
+#include <type_traits>
 #include <utility>
 
 namespace CdsUtil
@@ -31,8 +36,20 @@ namespace CdsUtil
     {
     };
 
+    // checks if std::hash is enabled for the provided class.
+    template <class T, class = void>
+    struct is_hashable : std::false_type
+    {
+    };
+
+    template <class T>
+    struct is_hashable<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T&>()))>>
+        : std::true_type
+    {
+    };
+
     // generate a random number using xorshift32 using provided seed.
-    uint32_t
+    inline uint32_t
     xorshift32(uint32_t seed)
     {
         seed ^= seed >> 13;
@@ -41,7 +58,7 @@ namespace CdsUtil
         return seed;
     }
 
-    uint32_t
+    inline uint32_t
     rand_nano()
     {
         auto now = std::chrono::high_resolution_clock::now();
@@ -52,7 +69,7 @@ namespace CdsUtil
 
     // generate a random nano-seeded num. constrained
     // to range [min, max].
-    uint32_t
+    inline uint32_t
     rand_range(uint32_t min, uint32_t max)
     {
         // the modulo constrains to [0, range-size -1] and
@@ -61,7 +78,7 @@ namespace CdsUtil
     }
 
     // generates an ASCII string
-    std::string
+    inline std::string
     string_generator()
     {
         std::string ret = "";
@@ -71,7 +88,7 @@ namespace CdsUtil
     }
 
     // asserts with a msg and with printf style formatting
-    void
+    inline void
     assertf(int line, bool condition, const char* msg, ...)
     {
         // if condition is false
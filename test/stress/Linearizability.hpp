@@ -0,0 +1,170 @@
+// =================================================================
+// Linearizability.hpp
+//  Description     History recording and a linearizability checker
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDSTEST_LINEARIZABILITY_HPP
+#define CDSTEST_LINEARIZABILITY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace CdsTest
+{
+    // one completed call, with the clock ticks of its invocation and response
+    struct Operation
+    {
+        uint32_t kind;
+        uint32_t value;
+        size_t index;
+        int64_t result;
+        uint64_t invoke;
+        uint64_t response;
+    };
+
+    // result of a call that found nothing (IndexOf miss, empty TryPop)
+    constexpr int64_t NoResult = -1;
+
+    /**
+     * History -- records the calls of several threads against one shared
+     *  clock. A call that responded before another was invoked has the
+     *  smaller ticks, which is all the checker needs of real time.
+     */
+    class History
+    {
+    private:
+        std::atomic<uint64_t> clock;
+        std::vector<std::vector<Operation>> logs;
+
+    public:
+        explicit History(size_t threads) : clock(0), logs(threads) {}
+
+        // runs call() as thread, recording it with the result it returns
+        template <typename Call>
+        void Record(size_t thread, uint32_t kind, uint32_t value, size_t index, Call call);
+
+        // every recorded call, in no particular order
+        std::vector<Operation> Operations() const;
+    };
+
+    // Whether some order of ops, consistent with real time, gives every
+    // recorded result when applied to Spec from initial. Uses the
+    // Wing-Gong-Lowe search, memoizing (linearized set, state) pairs.
+    //
+    // A Spec supplies a State, ordered by <, and
+    //     static bool Apply(State& state, const Operation& op)
+    // which applies op and returns whether op's result matches.
+    template <typename Spec>
+    bool IsLinearizable(const std::vector<Operation>& ops, typename Spec::State initial);
+
+    /**
+     * SequenceSpec -- a list under IList: Insert at the front or an index,
+     *  Remove of the first match, Search, IndexOf, Get (whether the index
+     *  was in range, since the element may be freed once Get returns), Size,
+     *  and Clear.
+     */
+    struct SequenceSpec
+    {
+        enum Kind : uint32_t
+        {
+            Insert,
+            InsertAt,
+            Remove,
+            Search,
+            IndexOf,
+            Get,
+            Size,
+            Clear
+        };
+        using State = std::vector<uint32_t>;
+
+        static bool Apply(State& state, const Operation& op);
+    };
+
+    /**
+     * MultisetSpec -- a list used as a bag: Insert, Remove of any match, and
+     *  Search. For lists whose order is only defined while they are quiet.
+     *
+     * A scan can pass the front, miss a copy inserted there, and then find
+     * the copy it was heading for removed, so a value that was always present
+     * is reported missing. Histories only fit this spec when each value is
+     * inserted and removed by one thread.
+     */
+    struct MultisetSpec
+    {
+        enum Kind : uint32_t
+        {
+            Insert,
+            Remove,
+            Search
+        };
+        using State = std::vector<uint32_t>;
+
+        static bool Apply(State& state, const Operation& op);
+    };
+
+    /**
+     * SetSpec -- an ordered set: Insert (false if present), Remove, Search.
+     */
+    struct SetSpec
+    {
+        enum Kind : uint32_t
+        {
+            Insert,
+            Remove,
+            Search
+        };
+        using State = std::vector<uint32_t>;
+
+        static bool Apply(State& state, const Operation& op);
+    };
+
+    /**
+     * QueueSpec / StackSpec -- Push, and TryPop giving the value or NoResult.
+     */
+    struct QueueSpec
+    {
+        enum Kind : uint32_t
+        {
+            Push,
+            TryPop
+        };
+        using State = std::deque<uint32_t>;
+
+        static bool Apply(State& state, const Operation& op);
+    };
+
+    /**
+     * WeakQueueSpec -- QueueSpec, but TryPop may report empty at any time.
+     *  For queues whose pops wait on the oldest claimed cell, which an
+     *  unfinished Push may still be filling.
+     */
+    struct WeakQueueSpec
+    {
+        using Kind = QueueSpec::Kind;
+        using State = QueueSpec::State;
+
+        static bool Apply(State& state, const Operation& op);
+    };
+
+    struct StackSpec
+    {
+        enum Kind : uint32_t
+        {
+            Push,
+            TryPop
+        };
+        using State = std::vector<uint32_t>;
+
+        static bool Apply(State& state, const Operation& op);
+    };
+} // namespace CdsTest
+
+#include <stress/Linearizability.tpp>
+
+#endif // CDSTEST_LINEARIZABILITY_HPP
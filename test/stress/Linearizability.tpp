@@ -0,0 +1,249 @@
+// =================================================================
+// Linearizability.tpp
+//  Description     History recording and a linearizability checker
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <algorithm>
+#include <set>
+#include <stress/Linearizability.hpp>
+#include <utility>
+
+template <typename Call>
+void
+CdsTest::History::Record(size_t thread, uint32_t kind, uint32_t value, size_t index, Call call)
+{
+    Operation op = {kind, value, index, 0, clock.fetch_add(1), 0};
+    op.result = call();
+    op.response = clock.fetch_add(1);
+    logs[thread].push_back(op);
+}
+
+inline std::vector<CdsTest::Operation>
+CdsTest::History::Operations() const
+{
+    std::vector<Operation> all;
+    for (const std::vector<Operation>& log : logs)
+        all.insert(all.end(), log.begin(), log.end());
+    return all;
+}
+
+// The calls and returns of every op form one list in time order. The search
+// linearizes the first call it can, lifting it and its return out of the
+// list, and backtracks when it reaches a return whose call it has not
+// linearized, since that op had to take effect before then.
+template <typename Spec>
+bool
+CdsTest::IsLinearizable(const std::vector<Operation>& ops, typename Spec::State initial)
+{
+    using State = typename Spec::State;
+
+    struct Entry
+    {
+        size_t op;
+        bool call;
+        uint64_t time;
+        Entry* match;
+        Entry* prev;
+        Entry* next;
+    };
+
+    // entries[0] heads the list
+    size_t n = ops.size();
+    std::vector<Entry> entries(2 * n + 1);
+    std::vector<Entry*> order;
+    for (size_t i = 0; i < n; ++i)
+    {
+        Entry* call = &entries[1 + 2 * i];
+        Entry* ret = &entries[2 + 2 * i];
+        *call = {i, true, ops[i].invoke, ret, nullptr, nullptr};
+        *ret = {i, false, ops[i].response, call, nullptr, nullptr};
+        order.push_back(call);
+        order.push_back(ret);
+    }
+    std::sort(order.begin(), order.end(), [](const Entry* a, const Entry* b) { return a->time < b->time; });
+
+    Entry* head = &entries[0];
+    *head = {n, false, 0, nullptr, nullptr, nullptr};
+    Entry* last = head;
+    for (Entry* entry : order)
+    {
+        last->next = entry;
+        entry->prev = last;
+        last = entry;
+    }
+
+    auto lift = [](Entry* call) {
+        call->prev->next = call->next;
+        call->next->prev = call->prev;
+        Entry* ret = call->match;
+        ret->prev->next = ret->next;
+        if (ret->next)
+            ret->next->prev = ret->prev;
+    };
+    auto unlift = [](Entry* call) {
+        Entry* ret = call->match;
+        ret->prev->next = ret;
+        if (ret->next)
+            ret->next->prev = ret;
+        call->prev->next = call;
+        call->next->prev = call;
+    };
+
+    std::vector<uint64_t> linearized((n + 63) / 64, 0);
+    std::set<std::pair<std::vector<uint64_t>, State>> seen;
+    std::vector<std::pair<Entry*, State>> stack;
+    State state = std::move(initial);
+    Entry* entry = head->next;
+    while (head->next)
+    {
+        if (entry->call)
+        {
+            State next = state;
+            if (Spec::Apply(next, ops[entry->op]))
+            {
+                std::vector<uint64_t> bits = linearized;
+                bits[entry->op / 64] |= uint64_t(1) << (entry->op % 64);
+
+                // a (set, state) pair seen before has already failed
+                if (seen.emplace(bits, next).second)
+                {
+                    stack.emplace_back(entry, std::move(state));
+                    state = std::move(next);
+                    linearized = std::move(bits);
+                    lift(entry);
+                    entry = head->next;
+                    continue;
+                }
+            }
+            entry = entry->next;
+        }
+        else
+        {
+            if (stack.empty())
+                return false;
+            entry = stack.back().first;
+            state = std::move(stack.back().second);
+            stack.pop_back();
+            linearized[entry->op / 64] &= ~(uint64_t(1) << (entry->op % 64));
+            unlift(entry);
+            entry = entry->next;
+        }
+    }
+    return true;
+}
+
+inline bool
+CdsTest::SequenceSpec::Apply(State& state, const Operation& op)
+{
+    auto found = std::find(state.begin(), state.end(), op.value);
+    switch (op.kind)
+    {
+    case Insert:
+        state.insert(state.begin(), op.value);
+        return op.result == 1;
+    case InsertAt:
+        if (op.index > state.size())
+            return op.result == 0;
+        state.insert(state.begin() + op.index, op.value);
+        return op.result == 1;
+    case Remove:
+        if (found == state.end())
+            return op.result == 0;
+        state.erase(found);
+        return op.result == 1;
+    case Search:
+        return op.result == (found != state.end());
+    case IndexOf:
+        return op.result == (found == state.end() ? NoResult : found - state.begin());
+    case Get:
+        return op.result == (op.index < state.size());
+    case Size:
+        return op.result == static_cast<int64_t>(state.size());
+    case Clear:
+        state.clear();
+        return true;
+    }
+    return false;
+}
+
+// the bag is kept sorted, so equal bags are equal states
+inline bool
+CdsTest::MultisetSpec::Apply(State& state, const Operation& op)
+{
+    auto found = std::lower_bound(state.begin(), state.end(), op.value);
+    bool present = found != state.end() && *found == op.value;
+    switch (op.kind)
+    {
+    case Insert:
+        state.insert(found, op.value);
+        return op.result == 1;
+    case Remove:
+        if (present)
+            state.erase(found);
+        return op.result == present;
+    case Search:
+        return op.result == present;
+    }
+    return false;
+}
+
+inline bool
+CdsTest::SetSpec::Apply(State& state, const Operation& op)
+{
+    auto found = std::lower_bound(state.begin(), state.end(), op.value);
+    bool present = found != state.end() && *found == op.value;
+    switch (op.kind)
+    {
+    case Insert:
+        if (!present)
+            state.insert(found, op.value);
+        return op.result == !present;
+    case Remove:
+        if (present)
+            state.erase(found);
+        return op.result == present;
+    case Search:
+        return op.result == present;
+    }
+    return false;
+}
+
+inline bool
+CdsTest::QueueSpec::Apply(State& state, const Operation& op)
+{
+    if (op.kind == Push)
+    {
+        state.push_back(op.value);
+        return true;
+    }
+    if (state.empty())
+        return op.result == NoResult;
+    int64_t front = state.front();
+    state.pop_front();
+    return op.result == front;
+}
+
+inline bool
+CdsTest::WeakQueueSpec::Apply(State& state, const Operation& op)
+{
+    if (op.kind == QueueSpec::TryPop && op.result == NoResult)
+        return true;
+    return QueueSpec::Apply(state, op);
+}
+
+inline bool
+CdsTest::StackSpec::Apply(State& state, const Operation& op)
+{
+    if (op.kind == Push)
+    {
+        state.push_back(op.value);
+        return true;
+    }
+    if (state.empty())
+        return op.result == NoResult;
+    int64_t top = state.back();
+    state.pop_back();
+    return op.result == top;
+}
@@ -0,0 +1,100 @@
+// =================================================================
+// Stress.cpp
+//  Description     Concurrent stress and linearizability tests
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <stress/Stress.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <libcds/BPlusTree.hpp>
+#include <libcds/BoundedMPMCQueue.hpp>
+#include <libcds/DoublyLinkedList.hpp>
+#include <libcds/FineGrainedDoublyLinkedList.hpp>
+#include <libcds/IndexableSkipList.hpp>
+#include <libcds/LinkedList.hpp>
+#include <libcds/LockFreeLinkedList.hpp>
+#include <libcds/LockFreeQueue.hpp>
+#include <libcds/LockFreeStack.hpp>
+#include <libcds/UnrolledLinkedList.hpp>
+#include <util.hpp>
+
+// usage: StressTester [scale]. Scale multiplies the rounds and calls, so
+// sanitizer builds can run lighter and soak runs heavier.
+int
+main(int argc, char** argv)
+{
+    size_t scale = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1;
+    scale = scale == 0 ? 1 : scale;
+    size_t rounds = 200 * scale;
+    size_t threads = 8;
+    size_t ops = 5000 * scale;
+
+    // line buffered, so a failed history is printed before the abort
+    setvbuf(stdout, nullptr, _IOLBF, BUFSIZ);
+
+    printf("Testing the linearizability checker...");
+    CdsTest::TestChecker();
+    printf("OK.\n");
+
+    printf("Testing LinkedList under shared use...");
+    CdsTest::StressSequence<CDS::LinkedList<uint32_t>>(rounds);
+    CdsTest::StressSequence<CDS::LinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>(rounds);
+    CdsTest::StressSequence<CDS::LinkedList<uint32_t, CDS::NodePool<uint32_t>>>(rounds);
+    CdsTest::HammerList<CDS::LinkedList<uint32_t>>(threads, ops);
+    CdsTest::HammerList<CDS::LinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>(threads, ops);
+    CdsTest::HammerList<CDS::LinkedList<uint32_t, CDS::NodePool<uint32_t>>>(threads, ops);
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList under shared use...");
+    CdsTest::StressSequence<CDS::DoublyLinkedList<uint32_t>>(rounds);
+    CdsTest::StressSequence<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::ExclusiveLock, CDS::HashIndex>>(rounds);
+    CdsTest::HammerList<CDS::DoublyLinkedList<uint32_t>>(threads, ops);
+    CdsTest::HammerList<CDS::DoublyLinkedList<uint32_t, CDS::NodePool<uint32_t>, CDS::SharedLock, CDS::HashIndex>>(threads, ops);
+    printf("OK.\n");
+
+    printf("Testing UnrolledLinkedList under shared use...");
+    CdsTest::StressSequence<CDS::UnrolledLinkedList<uint32_t>>(rounds);
+    CdsTest::HammerList<CDS::UnrolledLinkedList<uint32_t>>(threads, ops);
+    printf("OK.\n");
+
+    printf("Testing IndexableSkipList under shared use...");
+    CdsTest::StressSequence<CDS::IndexableSkipList<uint32_t>>(rounds);
+    CdsTest::HammerList<CDS::IndexableSkipList<uint32_t>>(threads, ops);
+    printf("OK.\n");
+
+    printf("Testing FineGrainedDoublyLinkedList under shared use...");
+    CdsTest::StressMultiset<CDS::FineGrainedDoublyLinkedList<uint32_t>>(rounds);
+    CdsTest::HammerList<CDS::FineGrainedDoublyLinkedList<uint32_t>>(threads, ops);
+    printf("OK.\n");
+
+    printf("Testing LockFreeLinkedList under shared use...");
+    CdsTest::StressMultiset<CDS::LockFreeLinkedList<uint32_t>>(rounds);
+    CdsTest::HammerList<CDS::LockFreeLinkedList<uint32_t>>(threads, ops);
+    printf("OK.\n");
+
+    printf("Testing BPlusTree under shared use...");
+    CdsTest::StressSet<CDS::BPlusTree<uint32_t>>(rounds);
+    CdsTest::HammerSet<CDS::BPlusTree<uint32_t>>(threads, ops);
+    CdsTest::HammerSet<CDS::BPlusTree<uint32_t, std::less<uint32_t>, 1>>(threads, ops);
+    printf("OK.\n");
+
+    // a failed pop may overtake a push still filling an older cell
+    printf("Testing BoundedMPMCQueue under shared use...");
+    CdsTest::StressPushPop<CDS::BoundedMPMCQueue<uint32_t>, CdsTest::WeakQueueSpec>(rounds);
+    CdsTest::HammerPushPop<CDS::BoundedMPMCQueue<uint32_t>>(threads, ops, true);
+    printf("OK.\n");
+
+    printf("Testing LockFreeQueue under shared use...");
+    CdsTest::StressPushPop<CDS::LockFreeQueue<uint32_t>, CdsTest::QueueSpec>(rounds);
+    CdsTest::HammerPushPop<CDS::LockFreeQueue<uint32_t>>(threads, ops, true);
+    printf("OK.\n");
+
+    printf("Testing LockFreeStack under shared use...");
+    CdsTest::StressPushPop<CDS::LockFreeStack<uint32_t>, CdsTest::StackSpec>(rounds);
+    CdsTest::HammerPushPop<CDS::LockFreeStack<uint32_t>>(threads, ops, false);
+    printf("OK.\n");
+    return 0;
+}
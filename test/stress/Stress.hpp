@@ -0,0 +1,77 @@
+// =================================================================
+// Stress.hpp
+//  Description     Concurrent stress tests over shared containers
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#ifndef CDSTEST_STRESS_HPP
+#define CDSTEST_STRESS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stress/Linearizability.hpp>
+#include <thread>
+#include <vector>
+
+namespace CdsTest
+{
+    // threads and calls per thread in one checked round. The search is
+    // exponential in the worst case, so rounds stay short and numerous.
+    constexpr size_t RoundThreads = 4;
+    constexpr size_t RoundOps = 6;
+
+    // distinct values in the hammer tests, few enough that removes hit
+    constexpr uint32_t HammerValues = 16;
+
+    // runs RoundThreads threads of RoundOps calls on one fresh C, rounds
+    // times, and checks each history against Spec from an empty state.
+    // call(container, history, thread, random) makes and records one call.
+    template <typename C, typename Spec, typename Call>
+    void CheckRounds(size_t rounds, Call call);
+
+    // starts threads threads on work(thread) together, and joins them
+    template <typename Work>
+    void RunTogether(size_t threads, Work work);
+
+    // prints a history, one call per line, after a failed check
+    void PrintHistory(const std::vector<Operation>& ops);
+
+    // checks the checker on hand-built histories it must accept or reject
+    void TestChecker();
+
+    // checked rounds of a list under SequenceSpec, with positional calls
+    template <typename L>
+    void StressSequence(size_t rounds);
+
+    // checked rounds of a list under MultisetSpec
+    template <typename L>
+    void StressMultiset(size_t rounds);
+
+    // checked rounds of a tree under SetSpec
+    template <typename S>
+    void StressSet(size_t rounds);
+
+    // checked rounds of a queue or stack under Spec
+    template <typename Q, typename Spec>
+    void StressPushPop(size_t rounds);
+
+    // threads threads make ops random calls each on one list, whose size
+    // must then match the inserts and removes that succeeded
+    template <typename L>
+    void HammerList(size_t threads, size_t ops);
+
+    // as HammerList, over a wider key range so the tree splits
+    template <typename S>
+    void HammerSet(size_t threads, size_t ops);
+
+    // producers push distinct values while consumers pop. Every value must
+    // come out exactly once, and in push order per producer if fifo.
+    template <typename Q>
+    void HammerPushPop(size_t threads, size_t ops, bool fifo);
+} // namespace CdsTest
+
+#include <stress/Stress.tpp>
+
+#endif // CDSTEST_STRESS_HPP
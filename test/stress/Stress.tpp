@@ -0,0 +1,388 @@
+// =================================================================
+// Stress.tpp
+//  Description     Concurrent stress tests over shared containers
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <stress/Stress.hpp>
+#include <util.hpp>
+
+template <typename C, typename Spec, typename Call>
+void
+CdsTest::CheckRounds(size_t rounds, Call call)
+{
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        C container;
+        History history(RoundThreads);
+        RunTogether(RoundThreads, [&](size_t thread) {
+            uint32_t random = CdsUtil::xorshift32(CdsUtil::rand_nano() + static_cast<uint32_t>(thread) * 0x9E3779B9u) | 1;
+            for (size_t i = 0; i < RoundOps; ++i)
+            {
+                random = CdsUtil::xorshift32(random);
+                call(container, history, thread, random);
+
+                // let the other threads in between calls
+                if (random & 0x100)
+                    std::this_thread::yield();
+            }
+        });
+
+        std::vector<Operation> ops = history.Operations();
+        bool linearizable = IsLinearizable<Spec>(ops, typename Spec::State());
+        if (!linearizable)
+            PrintHistory(ops);
+        CdsUtil::assertf(__LINE__, linearizable, "Round %zu is not linearizable.", round);
+    }
+}
+
+template <typename Work>
+void
+CdsTest::RunTogether(size_t threads, Work work)
+{
+    // hold every thread until all have started, so they overlap
+    std::atomic<size_t> ready(0);
+    std::vector<std::thread> workers;
+    for (size_t thread = 0; thread < threads; ++thread)
+    {
+        workers.emplace_back([&ready, &work, threads, thread]() {
+            ready.fetch_add(1);
+            while (ready.load() < threads)
+                std::this_thread::yield();
+            work(thread);
+        });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+inline void
+CdsTest::PrintHistory(const std::vector<Operation>& ops)
+{
+    for (const Operation& op : ops)
+    {
+        printf("    kind %" PRIu32 " value %" PRIu32 " index %zu -> %" PRId64 " [%" PRIu64 ", %" PRIu64 "]\n",
+               op.kind, op.value, op.index, op.result, op.invoke, op.response);
+    }
+}
+
+inline void
+CdsTest::TestChecker()
+{
+    using Seq = SequenceSpec;
+    using Queue = QueueSpec;
+
+    // a search that starts after an insert ends must see it...
+    std::vector<Operation> stale = {{Seq::Insert, 1, 0, 1, 0, 1}, {Seq::Search, 1, 0, 0, 2, 3}};
+    CdsUtil::assertf(__LINE__, !IsLinearizable<Seq>(stale, {}), "Checker accepted a stale read.");
+
+    // ...but one that overlaps it may go first
+    std::vector<Operation> overlap = {{Seq::Insert, 1, 0, 1, 0, 3}, {Seq::Search, 1, 0, 0, 1, 2}};
+    CdsUtil::assertf(__LINE__, IsLinearizable<Seq>(overlap, {}), "Checker rejected an overlapping read.");
+
+    // positions follow the chosen order: 2 then 1 at the front gives [1, 2]
+    std::vector<Operation> order = {{Seq::Insert, 1, 0, 1, 0, 5},
+                                    {Seq::Insert, 2, 0, 1, 1, 2},
+                                    {Seq::IndexOf, 2, 0, 1, 6, 7},
+                                    {Seq::Get, 0, 1, 1, 6, 8},
+                                    {Seq::Size, 0, 0, 2, 7, 9}};
+    CdsUtil::assertf(__LINE__, IsLinearizable<Seq>(order, {}), "Checker rejected a valid order.");
+    order[2].result = 2;
+    CdsUtil::assertf(__LINE__, !IsLinearizable<Seq>(order, {}), "Checker accepted an impossible index.");
+
+    // pushes that end before a pop starts come out in order
+    std::vector<Operation> fifo = {{Queue::Push, 1, 0, 0, 0, 1}, {Queue::Push, 2, 0, 0, 2, 3}, {Queue::TryPop, 0, 0, 2, 4, 5}};
+    CdsUtil::assertf(__LINE__, !IsLinearizable<Queue>(fifo, {}), "Checker accepted a reordered queue.");
+    CdsUtil::assertf(__LINE__, IsLinearizable<StackSpec>(fifo, {}), "Checker rejected a valid stack.");
+    fifo[1].invoke = 0;
+    CdsUtil::assertf(__LINE__, IsLinearizable<Queue>(fifo, {}), "Checker rejected overlapping pushes.");
+
+    // only the weak queue may miss an element
+    std::vector<Operation> missed = {{Queue::Push, 1, 0, 0, 0, 1}, {Queue::TryPop, 0, 0, NoResult, 2, 3}};
+    CdsUtil::assertf(__LINE__, !IsLinearizable<Queue>(missed, {}), "Checker accepted a missed element.");
+    CdsUtil::assertf(__LINE__, IsLinearizable<WeakQueueSpec>(missed, {}), "Checker rejected a weak empty pop.");
+
+    // a set refuses a second insert, a bag does not
+    std::vector<Operation> twice = {{SetSpec::Insert, 1, 0, 1, 0, 1}, {SetSpec::Insert, 1, 0, 1, 2, 3}};
+    CdsUtil::assertf(__LINE__, !IsLinearizable<SetSpec>(twice, {}), "Checker accepted a duplicate insert.");
+    CdsUtil::assertf(__LINE__, IsLinearizable<MultisetSpec>(twice, {}), "Checker rejected a duplicate in a bag.");
+}
+
+template <typename L>
+void
+CdsTest::StressSequence(size_t rounds)
+{
+    CheckRounds<L, SequenceSpec>(rounds, [](L& list, History& history, size_t thread, uint32_t random) {
+        using Spec = SequenceSpec;
+        uint32_t value = (random >> 8) % 3;
+        size_t index = (random >> 16) % 3;
+        switch (random % 16)
+        {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+            history.Record(thread, Spec::Insert, value, 0, [&]() -> int64_t { return list.Insert(value); });
+            break;
+        case 4:
+        case 5:
+            history.Record(thread, Spec::InsertAt, value, index, [&]() -> int64_t { return list.Insert(value, index); });
+            break;
+        case 6:
+        case 7:
+        case 8:
+            history.Record(thread, Spec::Remove, value, 0, [&]() -> int64_t { return list.Remove(value); });
+            break;
+        case 9:
+        case 10:
+            history.Record(thread, Spec::Search, value, 0, [&]() -> int64_t { return list.Search(value); });
+            break;
+        case 11:
+            history.Record(thread, Spec::IndexOf, value, 0, [&]() -> int64_t {
+                size_t found = list.IndexOf(value);
+                return found == static_cast<size_t>(-1) ? NoResult : static_cast<int64_t>(found);
+            });
+            break;
+        case 12:
+            // the element may be removed as soon as Get returns, so only
+            // whether it was found is checked
+            history.Record(thread, Spec::Get, 0, index, [&]() -> int64_t { return list.Get(index) != nullptr; });
+            break;
+        case 13:
+        case 14:
+            history.Record(thread, Spec::Size, 0, 0, [&]() -> int64_t { return static_cast<int64_t>(list.Size()); });
+            break;
+        default:
+            history.Record(thread, Spec::Clear, 0, 0, [&]() -> int64_t {
+                list.Clear();
+                return 1;
+            });
+            break;
+        }
+    });
+}
+
+// Each thread writes its own two values and reads everyone's; see MultisetSpec.
+template <typename L>
+void
+CdsTest::StressMultiset(size_t rounds)
+{
+    CheckRounds<L, MultisetSpec>(rounds, [](L& list, History& history, size_t thread, uint32_t random) {
+        using Spec = MultisetSpec;
+        uint32_t own = static_cast<uint32_t>(thread) * 2 + (random >> 8) % 2;
+        uint32_t any = (random >> 8) % (RoundThreads * 2);
+        switch (random % 8)
+        {
+        case 0:
+        case 1:
+        case 2:
+            history.Record(thread, Spec::Insert, own, 0, [&]() -> int64_t { return list.Insert(own); });
+            break;
+        case 3:
+        case 4:
+        case 5:
+            history.Record(thread, Spec::Remove, own, 0, [&]() -> int64_t { return list.Remove(own); });
+            break;
+        default:
+            history.Record(thread, Spec::Search, any, 0, [&]() -> int64_t { return list.Search(any); });
+            break;
+        }
+    });
+}
+
+template <typename S>
+void
+CdsTest::StressSet(size_t rounds)
+{
+    CheckRounds<S, SetSpec>(rounds, [](S& set, History& history, size_t thread, uint32_t random) {
+        using Spec = SetSpec;
+        uint32_t value = (random >> 8) % 4;
+        switch (random % 3)
+        {
+        case 0:
+            history.Record(thread, Spec::Insert, value, 0, [&]() -> int64_t { return set.Insert(value); });
+            break;
+        case 1:
+            history.Record(thread, Spec::Remove, value, 0, [&]() -> int64_t { return set.Remove(value); });
+            break;
+        default:
+            history.Record(thread, Spec::Search, value, 0, [&]() -> int64_t { return set.Search(value); });
+            break;
+        }
+    });
+}
+
+template <typename Q, typename Spec>
+void
+CdsTest::StressPushPop(size_t rounds)
+{
+    CheckRounds<Q, Spec>(rounds, [](Q& queue, History& history, size_t thread, uint32_t random) {
+        uint32_t value = random >> 8;
+        if (random % 2 == 0)
+        {
+            history.Record(thread, QueueSpec::Push, value, 0, [&]() -> int64_t {
+                queue.Push(value);
+                return 0;
+            });
+        }
+        else
+        {
+            history.Record(thread, QueueSpec::TryPop, 0, 0, [&]() -> int64_t {
+                uint32_t out;
+                return queue.TryPop(out) ? static_cast<int64_t>(out) : NoResult;
+            });
+        }
+    });
+}
+
+template <typename L>
+void
+CdsTest::HammerList(size_t threads, size_t ops)
+{
+    L list;
+    std::atomic<size_t> inserted(0);
+    std::atomic<size_t> removed(0);
+    RunTogether(threads, [&](size_t thread) {
+        uint32_t random = CdsUtil::xorshift32(CdsUtil::rand_nano() + static_cast<uint32_t>(thread) * 0x9E3779B9u) | 1;
+        for (size_t i = 0; i < ops; ++i)
+        {
+            random = CdsUtil::xorshift32(random);
+            uint32_t value = (random >> 8) % HammerValues;
+            size_t index = (random >> 16) % 8;
+            switch (random % 8)
+            {
+            case 0:
+            case 1:
+                if (list.Insert(value))
+                    inserted.fetch_add(1);
+                break;
+            case 2:
+                if (list.Insert(value, index))
+                    inserted.fetch_add(1);
+                break;
+            case 3:
+            case 4:
+            case 5:
+                // as many removes as inserts, so the list stays short
+                if (list.Remove(value))
+                    removed.fetch_add(1);
+                break;
+            case 6:
+                list.Search(value);
+                list.IndexOf(value);
+                break;
+            default:
+                list.Get(index);
+                list.Size();
+                break;
+            }
+        }
+    });
+
+    size_t expected = inserted.load() - removed.load();
+    CdsUtil::assertf(__LINE__, list.Size() == expected, "Size %zu after %zu net inserts.", list.Size(), expected);
+
+    // every element is one of the values, so removing them all empties it
+    for (uint32_t value = 0; value < HammerValues; ++value)
+    {
+        while (list.Remove(value))
+            --expected;
+    }
+    CdsUtil::assertf(__LINE__, expected == 0 && list.Size() == 0, "%zu elements lost or left behind.", expected);
+}
+
+template <typename S>
+void
+CdsTest::HammerSet(size_t threads, size_t ops)
+{
+    const uint32_t keys = 4096;
+    S set;
+    std::atomic<size_t> inserted(0);
+    std::atomic<size_t> removed(0);
+    RunTogether(threads, [&](size_t thread) {
+        uint32_t random = CdsUtil::xorshift32(CdsUtil::rand_nano() + static_cast<uint32_t>(thread) * 0x9E3779B9u) | 1;
+        for (size_t i = 0; i < ops; ++i)
+        {
+            random = CdsUtil::xorshift32(random);
+            uint32_t key = (random >> 8) % keys;
+            switch (random % 4)
+            {
+            case 0:
+            case 1:
+                if (set.Insert(key))
+                    inserted.fetch_add(1);
+                break;
+            case 2:
+                if (set.Remove(key))
+                    removed.fetch_add(1);
+                break;
+            default:
+                set.Search(key);
+                break;
+            }
+        }
+    });
+
+    size_t expected = inserted.load() - removed.load();
+    CdsUtil::assertf(__LINE__, set.Size() == expected, "Size %zu after %zu net inserts.", set.Size(), expected);
+
+    size_t found = 0;
+    for (uint32_t key = 0; key < keys; ++key)
+        found += set.Search(key);
+    CdsUtil::assertf(__LINE__, found == expected, "Found %zu of %zu keys.", found, expected);
+}
+
+template <typename Q>
+void
+CdsTest::HammerPushPop(size_t threads, size_t ops, bool fifo)
+{
+    size_t producers = std::max<size_t>(threads / 2, 1);
+    Q queue;
+    std::atomic<size_t> finished(0);
+    std::vector<std::vector<uint32_t>> popped(threads);
+    RunTogether(threads, [&](size_t thread) {
+        if (thread < producers)
+        {
+            for (size_t i = 0; i < ops; ++i)
+                queue.Push(static_cast<uint32_t>(thread * ops + i));
+            finished.fetch_add(1);
+            return;
+        }
+
+        // once every producer has finished, a failed pop means empty
+        uint32_t value;
+        while (true)
+        {
+            bool done = finished.load() == producers;
+            if (queue.TryPop(value))
+                popped[thread].push_back(value);
+            else if (done)
+                break;
+            else
+                std::this_thread::yield();
+        }
+    });
+
+    std::vector<bool> seen(producers * ops, false);
+    size_t total = 0;
+    for (const std::vector<uint32_t>& values : popped)
+    {
+        std::vector<size_t> next(producers, 0);
+        for (uint32_t value : values)
+        {
+            CdsUtil::assertf(__LINE__, value < seen.size() && !seen[value], "Value %u popped twice or never pushed.", value);
+            seen[value] = true;
+            ++total;
+
+            size_t producer = value / ops;
+            size_t index = value % ops;
+            CdsUtil::assertf(__LINE__, !fifo || index >= next[producer], "Producer %zu's values popped out of order.", producer);
+            next[producer] = index + 1;
+        }
+    }
+    CdsUtil::assertf(__LINE__, total == seen.size(), "Popped %zu of %zu values.", total, seen.size());
+}
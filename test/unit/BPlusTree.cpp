@@ -0,0 +1,31 @@
+// =================================================================
+// BPlusTree.cpp
+//  Description     Unit tests for BPlusTree
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <unit/Test.hpp>
+#include <functional>
+#include <iostream>
+#include <libcds/BPlusTree.hpp>
+#include <util.hpp>
+
+int
+main()
+{
+    printf("Testing BPlusTree with uint32_t...");
+    CdsTest::TestOrderedTree<CDS::BPlusTree<uint32_t>>();
+    printf("OK.\n");
+
+    // single cache line nodes, so the tree is deep and splits constantly
+    printf("Testing BPlusTree with uint32_t and small nodes...");
+    CdsTest::TestOrderedTree<CDS::BPlusTree<uint32_t, std::less<uint32_t>, 1>>();
+    printf("OK.\n");
+
+    printf("Testing BPlusTree under concurrent readers and writers...");
+    CdsTest::TestConcurrentTree<CDS::BPlusTree<uint32_t>>();
+    CdsTest::TestConcurrentTree<CDS::BPlusTree<uint32_t, std::less<uint32_t>, 1>>();
+    printf("OK.\n");
+    return 0;
+}
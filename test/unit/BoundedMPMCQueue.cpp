@@ -0,0 +1,24 @@
+// =================================================================
+// BoundedMPMCQueue.cpp
+//  Description     Unit tests for BoundedMPMCQueue
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <unit/Test.hpp>
+#include <iostream>
+#include <libcds/BoundedMPMCQueue.hpp>
+#include <util.hpp>
+
+int
+main()
+{
+    printf("Testing BoundedMPMCQueue with uint32_t...");
+    CdsTest::TestPushPop<CDS::BoundedMPMCQueue<uint32_t>>(true);
+    printf("OK.\n");
+
+    printf("Testing BoundedMPMCQueue with std::string...");
+    CdsTest::TestElementOwnership<CDS::BoundedMPMCQueue<std::string>>();
+    printf("OK.\n");
+    return 0;
+}
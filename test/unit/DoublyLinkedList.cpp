@@ -9,21 +9,59 @@
 #include <cassert>
 #include <iostream>
 #include <libcds/DoublyLinkedList.hpp>
+#include <libcds/LinkedList.hpp>
 #include <thread>
 #include <util.hpp>
 
+template <>
 std::string
 CdsTest::TestList<CDS::DoublyLinkedList<std::string>, std::string>::Generate()
 {
     return CdsUtil::string_generator();
 }
 
+template <>
 uint32_t
 CdsTest::TestList<CDS::DoublyLinkedList<uint32_t>, uint32_t>::Generate()
 {
     return CdsUtil::rand_range(0, 250);
 }
 
+template <>
+std::string
+CdsTest::TestList<CDS::DoublyLinkedList<std::string, CDS::NodePool<std::string>>, std::string>::Generate()
+{
+    return CdsUtil::string_generator();
+}
+
+template <>
+uint32_t
+CdsTest::TestList<CDS::DoublyLinkedList<uint32_t, CDS::NodePool<uint32_t>>, uint32_t>::Generate()
+{
+    return CdsUtil::rand_range(0, 250);
+}
+
+template <>
+uint32_t
+CdsTest::TestList<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>, uint32_t>::Generate()
+{
+    return CdsUtil::rand_range(0, 250);
+}
+
+template <>
+uint32_t
+CdsTest::TestList<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::ExclusiveLock, CDS::HashIndex>, uint32_t>::Generate()
+{
+    return CdsUtil::rand_range(0, 250);
+}
+
+template <>
+std::string
+CdsTest::TestList<CDS::DoublyLinkedList<std::string, std::allocator<std::string>, CDS::ExclusiveLock, CDS::HashIndex>, std::string>::Generate()
+{
+    return CdsUtil::string_generator();
+}
+
 int
 main()
 {
@@ -36,5 +74,79 @@ main()
     CdsTest::TestList<CDS::DoublyLinkedList<std::string>, std::string> dll_str_tester;
     dll_str_tester.ExecuteManyUnits();
     printf("OK.\n");
+
+    printf("Testing DoublyLinkedList with uint32_t and NodePool...\n");
+    CdsTest::TestList<CDS::DoublyLinkedList<uint32_t, CDS::NodePool<uint32_t>>, uint32_t> dll_pool_uint32_tester;
+    dll_pool_uint32_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList with std::string and NodePool...\n");
+    CdsTest::TestList<CDS::DoublyLinkedList<std::string, CDS::NodePool<std::string>>, std::string> dll_pool_str_tester;
+    dll_pool_str_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList with uint32_t and SharedLock...\n");
+    CdsTest::TestList<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>, uint32_t> dll_shared_uint32_tester;
+    dll_shared_uint32_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList with uint32_t and HashIndex...\n");
+    CdsTest::TestList<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::ExclusiveLock, CDS::HashIndex>, uint32_t> dll_hash_uint32_tester;
+    dll_hash_uint32_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList with std::string and HashIndex...\n");
+    CdsTest::TestList<CDS::DoublyLinkedList<std::string, std::allocator<std::string>, CDS::ExclusiveLock, CDS::HashIndex>, std::string> dll_hash_str_tester;
+    dll_hash_str_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList move semantics...");
+    CdsTest::TestMoveSemantics<CDS::DoublyLinkedList<std::string>>();
+    CdsTest::TestMoveSemantics<CDS::DoublyLinkedList<std::string, CDS::NodePool<std::string>>>();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList sharing a NodePool with a LinkedList...");
+    CdsTest::TestSharedPool<CDS::LinkedList<uint32_t, CDS::NodePool<uint32_t>>, CDS::DoublyLinkedList<uint32_t, CDS::NodePool<uint32_t>>>();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList bulk operations...");
+    CdsTest::TestBulkOperations<CDS::DoublyLinkedList<uint32_t>>();
+    CdsTest::TestBulkOperations<CDS::DoublyLinkedList<uint32_t, CDS::NodePool<uint32_t>>>();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList iteration...");
+    CdsTest::TestIteration<CDS::DoublyLinkedList<uint32_t>>();
+    CdsTest::TestIteration<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList positional access...");
+    CdsTest::TestPositionalAccess<CDS::DoublyLinkedList<uint32_t>>();
+    CdsTest::TestPositionalAccess<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList value index...");
+    CdsTest::TestValueIndex<CDS::DoublyLinkedList<uint32_t>>();
+    CdsTest::TestValueIndex<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::ExclusiveLock, CDS::HashIndex>>();
+    CdsTest::TestValueIndex<CDS::DoublyLinkedList<uint32_t, CDS::NodePool<uint32_t>, CDS::SharedLock, CDS::HashIndex>>();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList algorithms...");
+    CdsTest::TestListAlgorithms<CDS::DoublyLinkedList<uint32_t>>();
+    CdsTest::TestListAlgorithms<CDS::DoublyLinkedList<uint32_t, CDS::NodePool<uint32_t>>>();
+    CdsTest::TestListAlgorithms<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>();
+    CdsTest::TestListAlgorithms<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::ExclusiveLock, CDS::HashIndex>>();
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList persistence...");
+    CdsTest::TestPersistence<CDS::DoublyLinkedList<uint32_t>, uint32_t>();
+    CdsTest::TestPersistence<CDS::DoublyLinkedList<uint32_t, CDS::NodePool<uint32_t>>, uint32_t>();
+    CdsTest::TestPersistence<CDS::DoublyLinkedList<std::string>, std::string>();
+    CdsTest::TestPersistence<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::ExclusiveLock, CDS::HashIndex>, uint32_t>();
+    printf("OK.\n");
+
+    // stats are compiled out here, see ListStats for the counted build
+    printf("Testing DoublyLinkedList statistics...");
+    CdsTest::TestStats<CDS::DoublyLinkedList<uint32_t>>(true);
+    printf("OK.\n");
     return 0;
 }
@@ -0,0 +1,42 @@
+// =================================================================
+// FineGrainedDoublyLinkedList.cpp
+//  Description     Unit tests for FineGrainedDoublyLinkedList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <unit/Test.hpp>
+#include <cassert>
+#include <iostream>
+#include <libcds/FineGrainedDoublyLinkedList.hpp>
+#include <thread>
+#include <util.hpp>
+
+template <>
+std::string
+CdsTest::TestList<CDS::FineGrainedDoublyLinkedList<std::string>, std::string>::Generate()
+{
+    return CdsUtil::string_generator();
+}
+
+template <>
+uint32_t
+CdsTest::TestList<CDS::FineGrainedDoublyLinkedList<uint32_t>, uint32_t>::Generate()
+{
+    return CdsUtil::rand_range(0, 250);
+}
+
+int
+main()
+{
+    printf("Testing FineGrainedDoublyLinkedList with uint32_t...\n");
+    CdsTest::TestList<CDS::FineGrainedDoublyLinkedList<uint32_t>, uint32_t> fgdll_uint32_tester;
+    fgdll_uint32_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing FineGrainedDoublyLinkedList with std::string...\n");
+    CdsTest::TestList<CDS::FineGrainedDoublyLinkedList<std::string>, std::string> fgdll_str_tester;
+    fgdll_str_tester.ExecuteManyUnits();
+    printf("OK.\n");
+    return 0;
+}
@@ -0,0 +1,46 @@
+// =================================================================
+// IndexableSkipList.cpp
+//  Description     Unit tests for IndexableSkipList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <unit/Test.hpp>
+#include <cassert>
+#include <iostream>
+#include <libcds/IndexableSkipList.hpp>
+#include <thread>
+#include <util.hpp>
+
+template <>
+std::string
+CdsTest::TestList<CDS::IndexableSkipList<std::string>, std::string>::Generate()
+{
+    return CdsUtil::string_generator();
+}
+
+template <>
+uint32_t
+CdsTest::TestList<CDS::IndexableSkipList<uint32_t>, uint32_t>::Generate()
+{
+    return CdsUtil::rand_range(0, 250);
+}
+
+int
+main()
+{
+    printf("Testing IndexableSkipList with uint32_t...\n");
+    CdsTest::TestList<CDS::IndexableSkipList<uint32_t>, uint32_t> isl_uint32_tester;
+    isl_uint32_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing IndexableSkipList with std::string...\n");
+    CdsTest::TestList<CDS::IndexableSkipList<std::string>, std::string> isl_str_tester;
+    isl_str_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing IndexableSkipList positional access...");
+    CdsTest::TestPositionalAccess<CDS::IndexableSkipList<uint32_t>>();
+    printf("OK.\n");
+    return 0;
+}
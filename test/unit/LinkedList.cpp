@@ -12,18 +12,41 @@
 #include <thread>
 #include <util.hpp>
 
+template <>
 std::string
 CdsTest::TestList<CDS::LinkedList<std::string>, std::string>::Generate()
 {
     return CdsUtil::string_generator();
 }
 
+template <>
 uint32_t
 CdsTest::TestList<CDS::LinkedList<uint32_t>, uint32_t>::Generate()
 {
     return CdsUtil::rand_range(0, 250);
 }
 
+template <>
+std::string
+CdsTest::TestList<CDS::LinkedList<std::string, CDS::NodePool<std::string>>, std::string>::Generate()
+{
+    return CdsUtil::string_generator();
+}
+
+template <>
+uint32_t
+CdsTest::TestList<CDS::LinkedList<uint32_t, CDS::NodePool<uint32_t>>, uint32_t>::Generate()
+{
+    return CdsUtil::rand_range(0, 250);
+}
+
+template <>
+uint32_t
+CdsTest::TestList<CDS::LinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>, uint32_t>::Generate()
+{
+    return CdsUtil::rand_range(0, 250);
+}
+
 int
 main()
 {
@@ -37,5 +60,57 @@ main()
     CdsTest::TestList<CDS::LinkedList<std::string>, std::string> ll_str_tester;
     ll_str_tester.ExecuteManyUnits();
     printf("OK.\n");
+
+    printf("Testing LinkedList with uint32_t and NodePool...\n");
+    CdsTest::TestList<CDS::LinkedList<uint32_t, CDS::NodePool<uint32_t>>, uint32_t> ll_pool_uint32_tester;
+    ll_pool_uint32_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing LinkedList with std::string and NodePool...\n");
+    CdsTest::TestList<CDS::LinkedList<std::string, CDS::NodePool<std::string>>, std::string> ll_pool_str_tester;
+    ll_pool_str_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing LinkedList with uint32_t and SharedLock...\n");
+    CdsTest::TestList<CDS::LinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>, uint32_t> ll_shared_uint32_tester;
+    ll_shared_uint32_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing LinkedList move semantics...");
+    CdsTest::TestMoveSemantics<CDS::LinkedList<std::string>>();
+    CdsTest::TestMoveSemantics<CDS::LinkedList<std::string, CDS::NodePool<std::string>>>();
+    printf("OK.\n");
+
+    printf("Testing LinkedList bulk operations...");
+    CdsTest::TestBulkOperations<CDS::LinkedList<uint32_t>>();
+    CdsTest::TestBulkOperations<CDS::LinkedList<uint32_t, CDS::NodePool<uint32_t>>>();
+    printf("OK.\n");
+
+    printf("Testing LinkedList iteration...");
+    CdsTest::TestIteration<CDS::LinkedList<uint32_t>>();
+    CdsTest::TestIteration<CDS::LinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>();
+    printf("OK.\n");
+
+    printf("Testing LinkedList positional access...");
+    CdsTest::TestPositionalAccess<CDS::LinkedList<uint32_t>>();
+    CdsTest::TestPositionalAccess<CDS::LinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>();
+    printf("OK.\n");
+
+    printf("Testing LinkedList algorithms...");
+    CdsTest::TestListAlgorithms<CDS::LinkedList<uint32_t>>();
+    CdsTest::TestListAlgorithms<CDS::LinkedList<uint32_t, CDS::NodePool<uint32_t>>>();
+    CdsTest::TestListAlgorithms<CDS::LinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>();
+    printf("OK.\n");
+
+    printf("Testing LinkedList persistence...");
+    CdsTest::TestPersistence<CDS::LinkedList<uint32_t>, uint32_t>();
+    CdsTest::TestPersistence<CDS::LinkedList<uint32_t, CDS::NodePool<uint32_t>>, uint32_t>();
+    CdsTest::TestPersistence<CDS::LinkedList<std::string>, std::string>();
+    printf("OK.\n");
+
+    // stats are compiled out here, see ListStats for the counted build
+    printf("Testing LinkedList statistics...");
+    CdsTest::TestStats<CDS::LinkedList<uint32_t>>(true);
+    printf("OK.\n");
     return 0;
 }
@@ -0,0 +1,36 @@
+// =================================================================
+// ListStats.cpp
+//  Description     Unit tests for the list statistics, built with
+//                  CDS_ENABLE_STATS
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <unit/Test.hpp>
+#include <libcds/DoublyLinkedList.hpp>
+#include <libcds/LinkedList.hpp>
+#include <util.hpp>
+
+#ifndef CDS_ENABLE_STATS
+#error "ListStats must be built with CDS_ENABLE_STATS"
+#endif
+
+int
+main()
+{
+    printf("Testing LinkedList statistics...");
+    CdsTest::TestStats<CDS::LinkedList<uint32_t>>(true);
+    CdsTest::TestStats<CDS::LinkedList<uint32_t, CDS::NodePool<uint32_t>>>(true);
+    CdsTest::TestStats<CDS::LinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>(true);
+    CdsTest::TestStats<CDS::LinkedList<uint32_t, std::allocator<uint32_t>, CDS::NoLock>>(false);
+    printf("OK.\n");
+
+    printf("Testing DoublyLinkedList statistics...");
+    CdsTest::TestStats<CDS::DoublyLinkedList<uint32_t>>(true);
+    CdsTest::TestStats<CDS::DoublyLinkedList<uint32_t, CDS::NodePool<uint32_t>>>(true);
+    CdsTest::TestStats<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::SharedLock>>(true);
+    CdsTest::TestStats<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::ExclusiveLock, CDS::HashIndex>>(true);
+    CdsTest::TestStats<CDS::DoublyLinkedList<uint32_t, std::allocator<uint32_t>, CDS::NoLock>>(false);
+    printf("OK.\n");
+    return 0;
+}
@@ -0,0 +1,42 @@
+// =================================================================
+// LockFreeLinkedList.cpp
+//  Description     Unit tests for LockFreeLinkedList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <unit/Test.hpp>
+#include <cassert>
+#include <iostream>
+#include <libcds/LockFreeLinkedList.hpp>
+#include <thread>
+#include <util.hpp>
+
+template <>
+std::string
+CdsTest::TestList<CDS::LockFreeLinkedList<std::string>, std::string>::Generate()
+{
+    return CdsUtil::string_generator();
+}
+
+template <>
+uint32_t
+CdsTest::TestList<CDS::LockFreeLinkedList<uint32_t>, uint32_t>::Generate()
+{
+    return CdsUtil::rand_range(0, 250);
+}
+
+int
+main()
+{
+    printf("Testing LockFreeLinkedList with uint32_t...\n");
+    CdsTest::TestList<CDS::LockFreeLinkedList<uint32_t>, uint32_t> lfll_uint32_tester;
+    lfll_uint32_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing LockFreeLinkedList with std::string...\n");
+    CdsTest::TestList<CDS::LockFreeLinkedList<std::string>, std::string> lfll_str_tester;
+    lfll_str_tester.ExecuteManyUnits();
+    printf("OK.\n");
+    return 0;
+}
@@ -0,0 +1,24 @@
+// =================================================================
+// LockFreeQueue.cpp
+//  Description     Unit tests for LockFreeQueue
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <unit/Test.hpp>
+#include <iostream>
+#include <libcds/LockFreeQueue.hpp>
+#include <util.hpp>
+
+int
+main()
+{
+    printf("Testing LockFreeQueue with uint32_t...");
+    CdsTest::TestPushPop<CDS::LockFreeQueue<uint32_t>>(true);
+    printf("OK.\n");
+
+    printf("Testing LockFreeQueue with std::string...");
+    CdsTest::TestElementOwnership<CDS::LockFreeQueue<std::string>>();
+    printf("OK.\n");
+    return 0;
+}
@@ -0,0 +1,24 @@
+// =================================================================
+// LockFreeStack.cpp
+//  Description     Unit tests for LockFreeStack
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <unit/Test.hpp>
+#include <iostream>
+#include <libcds/LockFreeStack.hpp>
+#include <util.hpp>
+
+int
+main()
+{
+    printf("Testing LockFreeStack with uint32_t...");
+    CdsTest::TestPushPop<CDS::LockFreeStack<uint32_t>>(false);
+    printf("OK.\n");
+
+    printf("Testing LockFreeStack with std::string...");
+    CdsTest::TestElementOwnership<CDS::LockFreeStack<std::string>>();
+    printf("OK.\n");
+    return 0;
+}
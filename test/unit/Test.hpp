@@ -8,8 +8,16 @@
 #ifndef CDSTEST_TEST_HPP
 #define CDSTEST_TEST_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <iterator>
 #include <libcds/DataStructure.hpp>
+#include <libcds/ListAlgorithms.hpp>
+#include <libcds/MappedListView.hpp>
+#include <libcds/NodePool.hpp>
+#include <libcds/Stats.hpp>
+#include <set>
 #include <string>
 #include <thread>
 #include <vector>
@@ -57,6 +65,75 @@ namespace CdsTest
         // ... test thread-safety
         void TestThreadSafe();
     };
+
+    // tests move construction/assignment and Emplace* of a list of strings
+    template <typename L>
+    void TestMoveSemantics();
+
+    // shares one NodePool between two lists whose node sizes differ, so one
+    // of them falls back to the heap, and checks nothing is dropped by Release
+    template <typename A, typename B>
+    void TestSharedPool();
+
+    // tests InsertRange, RemoveIf, RemoveAll, and Append of a list of uint32_t
+    template <typename L>
+    void TestBulkOperations();
+
+    // tests iterators, ForEach, Cursor, and Snapshot of a list of uint32_t
+    template <typename L>
+    void TestIteration();
+
+    // checks Get/Insert/Remove by position against a std::vector, in
+    // sequential, reverse, and scattered order, on a list of uint32_t
+    template <typename L>
+    void TestPositionalAccess();
+
+    // inserts T(i) at the front, middle, and end of a list, checking it
+    // against a std::vector. Used with a T wide enough that a node of L
+    // holds as few elements as it can.
+    template <typename L, typename T>
+    void TestInsertEnds();
+
+    // checks lookups by value, MoveToFront, and PopFront/PopBack against a
+    // std::vector, with many duplicates, on a list of uint32_t
+    template <typename L>
+    void TestValueIndex();
+
+    // checks Sort, ParallelSort, Merge, Unique, and ParallelFindAll on a
+    // list of uint32_t against the standard algorithms, stability included
+    template <typename L>
+    void TestListAlgorithms();
+
+    // checks the statistics of a list of uint32_t: operation counts,
+    // traversal lengths, allocations, lock waits (when countsLocks), reset,
+    // and Prometheus output. All zeros when CDS_ENABLE_STATS is not defined.
+    template <typename L>
+    void TestStats(bool countsLocks);
+
+    // round-trips a list of T (uint32_t or std::string) through Save, Load,
+    // and MappedListView, and checks that bad files are rejected untouched
+    template <typename L, typename T>
+    void TestPersistence();
+
+    // tests a queue (fifo) or stack of uint32_t: ordering, batches, and the
+    // IDataStructure members, then producers and consumers racing
+    template <typename C>
+    void TestPushPop(bool fifo);
+
+    // tests that a queue or stack of std::string moves elements in and out,
+    // and destroys whatever is left
+    template <typename C>
+    void TestElementOwnership();
+
+    // checks an ordered tree of uint32_t against a std::set: inserts,
+    // removes, searches, range queries, BulkLoad, and Clear
+    template <typename Tr>
+    void TestOrderedTree();
+
+    // writers insert and remove while readers search and scan a set of keys
+    // that is never removed
+    template <typename Tr>
+    void TestConcurrentTree();
 } // namespace CdsTest
 
 #include <unit/Test.tpp>
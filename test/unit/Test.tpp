@@ -6,6 +6,9 @@
 // =================================================================
 
 #include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 #include <thread>
 #include <type_traits>
 #include <unit/Test.hpp>
@@ -14,18 +17,12 @@
 template <typename T, typename K>
 CdsTest::TestList<T, K>::TestList()
 {
-    // enforce T being a child of IList
+    // enforce T being a child of IList, usable without virtual dispatch
     static_assert(std::is_base_of<CDS::IList<K>, T>::value, "Derived not derived from BaseClass");
+    static_assert(CDS::IsList<T, K>::value, "Derived does not satisfy CDS::IsList");
 
     // enforce that K has equality operator to itself
-    CdsUtil::assertf(__LINE__, CdsUtil::has_operator_equal<K>::value, "Secondary Type missing equal operator");
-}
-
-template <typename T, typename K>
-K
-CdsTest::TestList<T, K>::Generate()
-{
-    return (*generator)();
+    static_assert(CdsUtil::has_operator_equal<K>::value, "Secondary Type missing equal operator");
 }
 
 template <typename T, typename K>
@@ -254,3 +251,876 @@ CdsTest::TestList<T, K>::TestThreadSafe()
     delete list;
     list = nullptr;
 }
+
+// test move-aware insertion and moving whole lists
+template <typename L>
+void
+CdsTest::TestMoveSemantics()
+{
+    // rvalue insert moves rather than copies
+    L list;
+    std::string moved = CdsUtil::string_generator();
+    std::string copy = moved;
+    list.Insert(std::move(moved));
+    CdsUtil::assertf(__LINE__, moved.empty(), "Insert(T&&) copied instead of moving");
+
+    // emplace constructs from arguments, at front, back, and index
+    CdsUtil::assertf(__LINE__, list.EmplaceBack(3, 'x'), "EmplaceBack failed");
+    CdsUtil::assertf(__LINE__, list.EmplaceFront("front"), "EmplaceFront failed");
+    CdsUtil::assertf(__LINE__, list.Emplace(1, "middle"), "Emplace at index 1 failed");
+    CdsUtil::assertf(__LINE__, !list.Emplace(10, "bad"), "Emplace succeeded out of bounds");
+    CdsUtil::assertf(__LINE__, *list.Get(0) == "front" && *list.Get(1) == "middle", "Emplace placed values incorrectly");
+    CdsUtil::assertf(__LINE__, *list.Get(2) == copy && *list.Get(3) == "xxx", "Emplace placed values incorrectly");
+
+    // move construction steals every node
+    L stolen(std::move(list));
+    CdsUtil::assertf(__LINE__, list.Size() == 0 && stolen.Size() == 4, "Move construction left sizes %zu and %zu", list.Size(), stolen.Size());
+    CdsUtil::assertf(__LINE__, stolen.IndexOf("xxx") == 3, "Move construction reordered the list");
+
+    // move assignment replaces the target's contents
+    L target;
+    target.Insert(copy);
+    target = std::move(stolen);
+    CdsUtil::assertf(__LINE__, stolen.Size() == 0 && target.Size() == 4, "Move assignment left sizes %zu and %zu", stolen.Size(), target.Size());
+    CdsUtil::assertf(__LINE__, target.IndexOf("middle") == 1, "Move assignment reordered the list");
+
+    // moved-from lists remain usable
+    CdsUtil::assertf(__LINE__, list.Insert(copy) && list.Size() == 1, "Moved-from list is unusable");
+}
+
+// B outlives A, so B's allocator ends up the pool's sole owner
+template <typename A, typename B>
+void
+CdsTest::TestSharedPool()
+{
+    auto build = []() {
+        CDS::NodePool<uint32_t> pool;
+        A first(pool);
+        B second(pool);
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            first.Insert(i);
+            second.Insert(i, i);
+        }
+        return second;
+    };
+    B list = build();
+    CdsUtil::assertf(__LINE__, list.Size() == 100 && *list.Get(99) == 99, "List lost elements leaving a shared pool.");
+
+    // Clear must walk and free the unpooled nodes, not drop them
+    list.Clear();
+    CdsUtil::assertf(__LINE__, list.Size() == 0, "Clear left %zu elements.", list.Size());
+
+    // the same, through the allocator alone. The first request fixes the
+    // block size, so the wider one is served from the heap.
+    struct Wide
+    {
+        uint64_t words[3];
+    };
+    CDS::NodePool<uint32_t> pool;
+    pool.allocate(1);
+    Wide* wide = CDS::NodePool<Wide>(pool).allocate(1);
+    CdsUtil::assertf(__LINE__, !pool.Release(), "Release dropped a live unpooled allocation.");
+    CDS::NodePool<Wide>(pool).deallocate(wide, 1);
+    CdsUtil::assertf(__LINE__, pool.Release(), "Release refused with nothing unpooled live.");
+}
+
+template <typename L>
+void
+CdsTest::TestBulkOperations()
+{
+    // range insert keeps order and lands at index
+    L list;
+    std::vector<uint32_t> values = {1, 2, 3, 2, 5};
+    CdsUtil::assertf(__LINE__, list.InsertRange(values.begin(), values.end(), 0), "InsertRange into empty list failed");
+    CdsUtil::assertf(__LINE__, list.Size() == values.size(), "InsertRange size was %zu", list.Size());
+    std::vector<uint32_t> middle = {7, 8};
+    CdsUtil::assertf(__LINE__, list.InsertRange(middle.begin(), middle.end(), 2), "InsertRange at index 2 failed");
+    CdsUtil::assertf(__LINE__, *list.Get(2) == 7 && *list.Get(3) == 8 && *list.Get(4) == 3, "InsertRange placed values incorrectly");
+    CdsUtil::assertf(__LINE__, list.InsertRange(middle.begin(), middle.end(), list.Size()), "InsertRange at end failed");
+    CdsUtil::assertf(__LINE__, *list.Get(list.Size() - 1) == 8, "InsertRange at end placed values incorrectly");
+    CdsUtil::assertf(__LINE__, !list.InsertRange(middle.begin(), middle.end(), list.Size() + 1), "InsertRange succeeded out of bounds");
+    CdsUtil::assertf(__LINE__, list.Size() == 9, "Failed InsertRange changed size to %zu", list.Size());
+
+    // removal of every match, in one pass
+    CdsUtil::assertf(__LINE__, list.RemoveAll(2) == 2, "RemoveAll removed the wrong count");
+    CdsUtil::assertf(__LINE__, !list.Search(2), "RemoveAll left a match behind");
+    size_t removed = list.RemoveIf([](uint32_t value) { return value > 6; });
+    CdsUtil::assertf(__LINE__, removed == 4 && list.Size() == 3, "RemoveIf removed %zu, leaving %zu", removed, list.Size());
+    CdsUtil::assertf(__LINE__, list.IndexOf(1) == 0 && list.IndexOf(3) == 1 && list.IndexOf(5) == 2, "RemoveIf reordered the list");
+
+    // append splices other onto the end and empties it
+    L other;
+    other.InsertRange(middle.begin(), middle.end(), 0);
+    list.Append(std::move(other));
+    CdsUtil::assertf(__LINE__, other.Size() == 0 && list.Size() == 5, "Append left sizes %zu and %zu", other.Size(), list.Size());
+    CdsUtil::assertf(__LINE__, list.IndexOf(7) == 3 && list.IndexOf(8) == 4, "Append placed values incorrectly");
+    CdsUtil::assertf(__LINE__, other.Insert(9) && list.Insert(9, list.Size()), "Lists unusable after Append");
+
+    // appending into an empty list, then removing everything
+    L empty;
+    empty.Append(std::move(list));
+    CdsUtil::assertf(__LINE__, empty.Size() == 6 && list.Size() == 0, "Append into empty list left sizes %zu and %zu", empty.Size(), list.Size());
+    CdsUtil::assertf(__LINE__, empty.RemoveIf([](uint32_t) { return true; }) == 6 && empty.Size() == 0, "RemoveIf did not empty the list");
+    CdsUtil::assertf(__LINE__, empty.Insert(1) && *empty.Get(0) == 1, "List unusable after RemoveIf emptied it");
+}
+
+template <typename L>
+void
+CdsTest::TestIteration()
+{
+    L list;
+    std::vector<uint32_t> values = {4, 8, 15, 16, 23, 42};
+    list.InsertRange(values.begin(), values.end(), 0);
+
+    // range-for and <algorithm> see the list in order
+    std::vector<uint32_t> seen;
+    for (uint32_t value : list)
+        seen.push_back(value);
+    CdsUtil::assertf(__LINE__, seen == values, "Range-for visited the list out of order");
+    CdsUtil::assertf(__LINE__, std::distance(list.begin(), list.end()) == 6, "Iterator distance was wrong");
+    CdsUtil::assertf(__LINE__, *std::find(list.cbegin(), list.cend(), 16u) == 16, "std::find failed over const_iterator");
+    CdsUtil::assertf(__LINE__, std::find(list.cbegin(), list.cend(), 99u) == list.cend(), "std::find matched a missing value");
+
+    // mutable iterators write through
+    for (auto it = list.begin(); it != list.end(); ++it)
+        *it += 1;
+    CdsUtil::assertf(__LINE__, *list.Get(0) == 5 && *list.Get(5) == 43, "Writes through iterator were lost");
+
+    // bidirectional lists walk back from end()
+    using Category = typename std::iterator_traits<typename L::iterator>::iterator_category;
+    if constexpr (std::is_base_of<std::bidirectional_iterator_tag, Category>::value)
+    {
+        std::vector<uint32_t> reversed(std::make_reverse_iterator(list.end()), std::make_reverse_iterator(list.begin()));
+        CdsUtil::assertf(__LINE__, reversed.front() == 43 && reversed.back() == 5, "Reverse iteration was wrong");
+    }
+
+    // ForEach and Cursor visit everything under one lock
+    uint32_t sum = 0;
+    list.ForEach([&sum](const uint32_t& value) { sum += value; });
+    CdsUtil::assertf(__LINE__, sum == 114, "ForEach sum was %d", sum);
+    {
+        auto cursor = list.OpenCursor();
+        sum = 0;
+        for (uint32_t value : cursor)
+            sum += value;
+        CdsUtil::assertf(__LINE__, sum == 114 && cursor.Size() == 6, "Cursor sum was %d", sum);
+    }
+
+    // snapshots are shared until the list changes, and never change themselves
+    auto first = list.Snapshot();
+    CdsUtil::assertf(__LINE__, first->size() == 6 && first->front() == 5, "Snapshot contents were wrong");
+    CdsUtil::assertf(__LINE__, list.Snapshot() == first, "Snapshot of an unchanged list was rebuilt");
+    list.Insert(1);
+    auto second = list.Snapshot();
+    CdsUtil::assertf(__LINE__, second != first && second->size() == 7 && second->front() == 1, "Snapshot missed an insert");
+    CdsUtil::assertf(__LINE__, first->size() == 6, "Old snapshot changed after an insert");
+    list.Remove(1);
+    CdsUtil::assertf(__LINE__, list.Snapshot()->size() == 6, "Snapshot missed a remove");
+    list.Clear();
+    CdsUtil::assertf(__LINE__, list.Snapshot()->empty() && list.begin() == list.end(), "Snapshot or iterators missed a clear");
+}
+
+template <typename L>
+void
+CdsTest::TestPositionalAccess()
+{
+    L list;
+    std::vector<uint32_t> model;
+
+    // appends, then sequential reads in both directions
+    for (uint32_t i = 0; i < 500; ++i)
+    {
+        list.Insert(i, list.Size());
+        model.push_back(i);
+    }
+    for (size_t i = 0; i < model.size(); ++i)
+        CdsUtil::assertf(__LINE__, *list.Get(i) == model[i], "Forward Get(%zu) was wrong", i);
+    for (size_t i = model.size(); i-- > 0;)
+        CdsUtil::assertf(__LINE__, *list.Get(i) == model[i], "Backward Get(%zu) was wrong", i);
+
+    // scattered inserts and removes, each followed by reads near the change
+    for (uint32_t i = 0; i < 300; ++i)
+    {
+        size_t index = CdsUtil::rand_range(0, model.size());
+        uint32_t value = 1000 + i;
+        CdsUtil::assertf(__LINE__, list.Insert(value, index), "Insert at %zu failed", index);
+        model.insert(model.begin() + index, value);
+        if (index > 0)
+            CdsUtil::assertf(__LINE__, *list.Get(index - 1) == model[index - 1], "Get before insert point was wrong");
+        CdsUtil::assertf(__LINE__, *list.Get(index) == value, "Get at insert point was wrong");
+
+        size_t victim = CdsUtil::rand_range(0, model.size() - 1);
+        CdsUtil::assertf(__LINE__, list.Remove(model[victim]), "Remove of %d failed", model[victim]);
+        model.erase(model.begin() + victim);
+        if (victim < model.size())
+            CdsUtil::assertf(__LINE__, *list.Get(victim) == model[victim], "Get at removal point was wrong");
+    }
+
+    CdsUtil::assertf(__LINE__, list.Size() == model.size(), "Size was %zu, expected %zu", list.Size(), model.size());
+    for (size_t i = 0; i < model.size(); ++i)
+        CdsUtil::assertf(__LINE__, *list.Get(i) == model[i], "Get(%zu) was wrong after edits", i);
+    CdsUtil::assertf(__LINE__, list.Get(model.size()) == nullptr, "Get past the end returned a value");
+}
+
+template <typename L, typename T>
+void
+CdsTest::TestInsertEnds()
+{
+    L list;
+    std::vector<T> model;
+    for (uint32_t i = 0; i < 60; ++i)
+    {
+        size_t index = i % 3 == 0 ? 0 : i % 3 == 1 ? model.size() / 2 : model.size();
+        CdsUtil::assertf(__LINE__, list.Insert(T(i), index), "Insert at %zu failed", index);
+        model.insert(model.begin() + index, T(i));
+    }
+
+    CdsUtil::assertf(__LINE__, list.Size() == model.size(), "Size was %zu, expected %zu", list.Size(), model.size());
+    for (size_t i = 0; i < model.size(); ++i)
+        CdsUtil::assertf(__LINE__, *list.Get(i) == model[i], "Get(%zu) was wrong", i);
+
+    // appends alone split a full node with nothing after it
+    L appended;
+    for (uint32_t i = 0; i < 8; ++i)
+        appended.Insert(T(i), i);
+    for (uint32_t i = 0; i < 8; ++i)
+        CdsUtil::assertf(__LINE__, *appended.Get(i) == T(i), "Appended Get(%u) was wrong", i);
+}
+
+template <typename L>
+void
+CdsTest::TestValueIndex()
+{
+    L list;
+    std::vector<uint32_t> model;
+
+    // values from a small range, so most of them repeat
+    for (uint32_t i = 0; i < 2000; ++i)
+    {
+        uint32_t value = CdsUtil::rand_range(0, 40);
+        uint32_t op = CdsUtil::rand_range(0, 9);
+        if (op < 4)
+        {
+            size_t index = CdsUtil::rand_range(0, model.size());
+            list.Insert(value, index);
+            model.insert(model.begin() + index, value);
+        }
+        else if (op < 6)
+        {
+            auto it = std::find(model.begin(), model.end(), value);
+            CdsUtil::assertf(__LINE__, list.Remove(value) == (it != model.end()), "Remove(%u) disagreed", value);
+            if (it != model.end())
+                model.erase(it);
+        }
+        else if (op < 8)
+        {
+            auto it = std::find(model.begin(), model.end(), value);
+            CdsUtil::assertf(__LINE__, list.MoveToFront(value) == (it != model.end()), "MoveToFront(%u) disagreed", value);
+            if (it != model.end())
+                std::rotate(model.begin(), it, it + 1);
+        }
+        else if (!model.empty())
+        {
+            uint32_t out = 0;
+            bool front = op == 8;
+            CdsUtil::assertf(__LINE__, front ? list.PopFront(out) : list.PopBack(out), "Pop failed on a non-empty list");
+            CdsUtil::assertf(__LINE__, out == (front ? model.front() : model.back()), "Pop returned %u", out);
+            if (front)
+                model.erase(model.begin());
+            else
+                model.pop_back();
+        }
+
+        // every value keeps first-occurrence semantics
+        if (i % 100 == 0)
+        {
+            for (uint32_t v = 0; v <= 41; ++v)
+            {
+                auto it = std::find(model.begin(), model.end(), v);
+                size_t expected = it == model.end() ? list.npos : static_cast<size_t>(it - model.begin());
+                CdsUtil::assertf(__LINE__, list.IndexOf(v) == expected, "IndexOf(%u) was %zu, expected %zu", v, list.IndexOf(v), expected);
+                CdsUtil::assertf(__LINE__, list.Search(v) == (it != model.end()), "Search(%u) disagreed", v);
+            }
+        }
+    }
+
+    // bulk edits keep the index in step
+    list.RemoveAll(7);
+    model.erase(std::remove(model.begin(), model.end(), 7u), model.end());
+    L other;
+    std::vector<uint32_t> extra = {7, 7, 3, 100};
+    other.InsertRange(extra.begin(), extra.end(), 0);
+    list.Append(std::move(other));
+    model.insert(model.end(), extra.begin(), extra.end());
+    CdsUtil::assertf(__LINE__, list.IndexOf(7) == model.size() - 4 && list.IndexOf(100) == model.size() - 1, "Append left the index stale");
+    CdsUtil::assertf(__LINE__, !other.Search(7) && other.IndexOf(100) == other.npos, "Append left other's index stale");
+
+    L moved(std::move(list));
+    CdsUtil::assertf(__LINE__, moved.Search(100) && !list.Search(100), "Move construction left the index stale");
+    moved.Clear();
+    CdsUtil::assertf(__LINE__, !moved.Search(100) && moved.IndexOf(3) == moved.npos, "Clear left the index stale");
+    uint32_t out;
+    CdsUtil::assertf(__LINE__, !moved.PopFront(out) && !moved.PopBack(out) && !moved.MoveToFront(3), "Empty list reported success");
+}
+
+template <typename L>
+void
+CdsTest::TestListAlgorithms()
+{
+    // ordering by tens, so equal keys show whether a sort was stable
+    auto byTens = [](uint32_t a, uint32_t b) { return a / 10 < b / 10; };
+    auto fill = [](L& list, std::vector<uint32_t>& model, size_t count) {
+        std::vector<uint32_t> values;
+        for (size_t i = 0; i < count; ++i)
+            values.push_back(CdsUtil::rand_range(0, 5000));
+        list.InsertRange(values.begin(), values.end(), list.Size());
+        model.insert(model.end(), values.begin(), values.end());
+    };
+    auto matches = [](L& list, const std::vector<uint32_t>& model) {
+        if (list.Size() != model.size() || *list.Snapshot() != model)
+            return false;
+        for (size_t i = 0; i < model.size(); i += 97)
+        {
+            if (*list.Get(i) != model[i] || list.IndexOf(model[i]) > i)
+                return false;
+        }
+        return true;
+    };
+    CDS::ThreadPool pool(3);
+
+    // sequential sort, touching the list first so a cached position goes stale
+    L list;
+    std::vector<uint32_t> model;
+    list.Sort();
+    fill(list, model, 3000);
+    list.Get(1500);
+    list.Sort(byTens);
+    std::stable_sort(model.begin(), model.end(), byTens);
+    CdsUtil::assertf(__LINE__, matches(list, model), "Sort was wrong or unstable");
+
+    // parallel sort, large enough to split over every thread
+    L big;
+    std::vector<uint32_t> bigModel;
+    fill(big, bigModel, 4 * CDS::ParallelGrain + 123);
+    big.ParallelSort(byTens, pool);
+    std::stable_sort(bigModel.begin(), bigModel.end(), byTens);
+    CdsUtil::assertf(__LINE__, matches(big, bigModel), "ParallelSort was wrong or unstable");
+
+    // merging keeps ours first among equals, and empties other
+    std::vector<uint32_t> merged;
+    std::merge(model.begin(), model.end(), bigModel.begin(), bigModel.end(), std::back_inserter(merged), byTens);
+    list.Merge(std::move(big), byTens);
+    CdsUtil::assertf(__LINE__, matches(list, merged), "Merge was wrong or unstable");
+    CdsUtil::assertf(__LINE__, big.Size() == 0 && big.Snapshot()->empty(), "Merge left %zu elements in other", big.Size());
+    L empty;
+    list.Merge(std::move(empty));
+    CdsUtil::assertf(__LINE__, list.Size() == merged.size(), "Merge of an empty list changed the size");
+
+    // parallel find-all returns matches in list order
+    auto odd = [](uint32_t value) { return value % 2 == 1; };
+    std::vector<uint32_t> odds;
+    std::copy_if(merged.begin(), merged.end(), std::back_inserter(odds), odd);
+    CdsUtil::assertf(__LINE__, list.ParallelFindAll(odd, pool) == odds, "ParallelFindAll was wrong");
+    CdsUtil::assertf(__LINE__, empty.ParallelFindAll(odd, pool).empty(), "ParallelFindAll of an empty list found something");
+
+    // a throwing predicate reaches the caller, leaving the list as it was
+    bool threw = false;
+    try
+    {
+        list.ParallelFindAll([](uint32_t value) -> bool { throw value; }, pool);
+    }
+    catch (uint32_t)
+    {
+        threw = true;
+    }
+    CdsUtil::assertf(__LINE__, threw && matches(list, merged), "ParallelFindAll did not pass on an exception");
+
+    // unique drops runs of equal elements
+    list.Sort();
+    std::sort(merged.begin(), merged.end());
+    size_t duplicates = merged.end() - std::unique(merged.begin(), merged.end());
+    merged.resize(merged.size() - duplicates);
+    CdsUtil::assertf(__LINE__, list.Unique() == duplicates, "Unique removed the wrong count");
+    CdsUtil::assertf(__LINE__, matches(list, merged), "Unique left the wrong elements");
+    CdsUtil::assertf(__LINE__, list.Unique() == 0, "Unique of a unique list removed elements");
+}
+
+template <typename L>
+void
+CdsTest::TestStats(bool countsLocks)
+{
+    using CDS::Stat;
+
+    L list;
+    for (uint32_t i = 0; i < 10; ++i)
+        list.Insert(i, list.Size());
+    list.Search(9);
+    list.Search(100);
+    list.IndexOf(9);
+    list.Get(5);
+    list.Remove(0);
+    list.Remove(100);
+
+    CDS::ListStats stats = list.Stats();
+#ifdef CDS_ENABLE_STATS
+    CdsUtil::assertf(__LINE__, stats[Stat::Inserts] == 10, "Inserts was %zu, expected 10", (size_t)stats[Stat::Inserts]);
+    CdsUtil::assertf(__LINE__, stats[Stat::Searches] == 2, "Searches was %zu, expected 2", (size_t)stats[Stat::Searches]);
+    CdsUtil::assertf(__LINE__, stats[Stat::IndexOfs] == 1, "IndexOfs was %zu, expected 1", (size_t)stats[Stat::IndexOfs]);
+    CdsUtil::assertf(__LINE__, stats[Stat::Gets] == 1, "Gets was %zu, expected 1", (size_t)stats[Stat::Gets]);
+    CdsUtil::assertf(__LINE__, stats[Stat::Removes] == 2, "Removes was %zu, expected 2", (size_t)stats[Stat::Removes]);
+    CdsUtil::assertf(__LINE__, stats[Stat::Lookups] >= 4, "Lookups was %zu, expected at least 4", (size_t)stats[Stat::Lookups]);
+    CdsUtil::assertf(__LINE__, stats[Stat::Allocations] == 10, "Allocations was %zu, expected 10", (size_t)stats[Stat::Allocations]);
+    CdsUtil::assertf(__LINE__, stats[Stat::Deallocations] == 1, "Deallocations was %zu, expected 1", (size_t)stats[Stat::Deallocations]);
+
+    // a hit on the last of 10 nodes walks all 10, whichever end it starts from
+    CdsUtil::assertf(__LINE__, stats.AverageIndexOfLength() == 10.0, "IndexOf walked %f nodes, expected 10", stats.AverageIndexOfLength());
+    CdsUtil::assertf(__LINE__, stats.AverageLookupLength() <= 10.0, "Lookups walked %f nodes on average", stats.AverageLookupLength());
+    CdsUtil::assertf(__LINE__, stats[Stat::Seeks] >= 1 && stats.AverageSeekLength() <= 9.0, "Seeks walked %f nodes on average", stats.AverageSeekLength());
+    if (countsLocks)
+        CdsUtil::assertf(__LINE__, stats[Stat::LockAcquisitions] >= 16, "Lock was taken %zu times, expected at least 16", (size_t)stats[Stat::LockAcquisitions]);
+#else
+    for (size_t i = 0; i < CDS::StatCount; ++i)
+        CdsUtil::assertf(__LINE__, stats.values[i] == 0, "Stat %zu was counted with stats compiled out", i);
+#endif
+
+    // Clear frees every node still held
+    list.Clear();
+    stats = list.Stats();
+    CdsUtil::assertf(__LINE__, stats[Stat::Allocations] == stats[Stat::Deallocations], "Clear left %zu nodes allocated",
+                     (size_t)(stats[Stat::Allocations] - stats[Stat::Deallocations]));
+
+    list.ResetStats();
+    stats = list.Stats();
+    for (size_t i = 0; i < CDS::StatCount; ++i)
+        CdsUtil::assertf(__LINE__, stats.values[i] == 0, "Stat %zu was %zu after ResetStats", i, (size_t)stats.values[i]);
+
+    // an attached sink gets every snapshot, and the totals ResetStats drops
+    std::vector<std::pair<std::string, CDS::ListStats>> sunk;
+    list.SetStatsSink("sunk", [&sunk](const std::string& name, const CDS::ListStats& snapshot) { sunk.emplace_back(name, snapshot); });
+    list.Insert(7);
+    list.Stats();
+    list.ResetStats();
+    list.SetStatsSink("sunk", nullptr);
+    list.Stats();
+#ifdef CDS_ENABLE_STATS
+    CdsUtil::assertf(__LINE__, sunk.size() == 2, "Sink got %zu snapshots, expected 2", sunk.size());
+    CdsUtil::assertf(__LINE__, sunk[0].first == "sunk" && sunk[0].second[Stat::Inserts] == 1, "Sink got the wrong snapshot");
+    CdsUtil::assertf(__LINE__, sunk[1].second[Stat::Inserts] == 1, "Sink did not get the totals ResetStats dropped");
+#else
+    CdsUtil::assertf(__LINE__, sunk.empty(), "Sink was called with stats compiled out");
+#endif
+
+    // a writer blocked behind an open Cursor must wait for the lock. The
+    // cursor is held until the wait shows up, however long that takes.
+    if (countsLocks)
+    {
+        std::thread writer;
+        {
+            [[maybe_unused]] auto cursor = list.OpenCursor();
+            writer = std::thread([&list]() { list.Insert(1); });
+#ifdef CDS_ENABLE_STATS
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+            while (list.Stats()[Stat::LockContentions] == 0 && std::chrono::steady_clock::now() < deadline)
+                std::this_thread::yield();
+#endif
+        }
+        writer.join();
+
+        stats = list.Stats();
+#ifdef CDS_ENABLE_STATS
+        CdsUtil::assertf(__LINE__, stats[Stat::LockContentions] == 1, "Contentions was %zu, expected 1", (size_t)stats[Stat::LockContentions]);
+        CdsUtil::assertf(__LINE__, stats[Stat::LockWaitNanoseconds] > 0, "Lock wait was not timed");
+#endif
+    }
+
+    // every family is written with a sample for each list
+    std::ostringstream os;
+    CDS::WritePrometheus(os, {{"first", list.Stats()}, {"second \"quoted\"", CDS::ListStats()}});
+    std::string text = os.str();
+    CdsUtil::assertf(__LINE__, text.find("# TYPE cds_list_operations_total counter\n") != std::string::npos, "Missing operations family");
+    CdsUtil::assertf(__LINE__, text.find("cds_list_operations_total{list=\"first\",op=\"insert\"} ") != std::string::npos, "Missing insert sample");
+    CdsUtil::assertf(__LINE__, text.find("cds_list_lock_wait_seconds_total{list=\"second \\\"quoted\\\"\"} 0\n") != std::string::npos,
+                     "Label was not escaped");
+
+    // the sink keeps the latest snapshot per list and writes them all out
+    CDS::ListStats latest = list.Stats();
+    std::ostringstream expected;
+    CDS::WritePrometheus(expected, {{"first", latest}});
+    std::string path = "TestStats." + std::to_string(CdsUtil::rand_range(0, 1000000)) + ".prom";
+    CDS::PrometheusTextSink sink(path);
+    sink("first", CDS::ListStats());
+    sink("first", latest);
+    CdsUtil::assertf(__LINE__, sink.Flush(), "Sink could not write %s", path.c_str());
+    CdsUtil::assertf(__LINE__, sink.Flush(), "Sink could not replace %s", path.c_str());
+    std::ifstream in(path);
+    std::string written((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::remove(path.c_str());
+    CdsUtil::assertf(__LINE__, written == expected.str(), "Sink wrote the wrong text");
+}
+
+template <typename L, typename T>
+void
+CdsTest::TestPersistence()
+{
+    auto value = [](size_t i) {
+        if constexpr (std::is_same<T, std::string>::value)
+            return std::string(i % 7, 'x') + std::to_string(i);
+        else
+            return static_cast<T>(i * 7);
+    };
+    std::string path = "TestPersistence." + std::to_string(CdsUtil::rand_range(0, 1000000)) + ".bin";
+
+    L list;
+    std::vector<T> model;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        list.Insert(value(i), list.Size());
+        model.push_back(value(i));
+    }
+    CdsUtil::assertf(__LINE__, list.Save(path), "Save to %s failed", path.c_str());
+
+    // a file saved from another element type is rejected
+    {
+        CDS::MappedListView<uint64_t> other;
+        CdsUtil::assertf(__LINE__, !other.Open(path), "View of another element type opened %s", path.c_str());
+    }
+
+    // Load replaces whatever was there
+    L loaded;
+    loaded.Insert(value(5000));
+    CdsUtil::assertf(__LINE__, loaded.Load(path), "Load of %s failed", path.c_str());
+    CdsUtil::assertf(__LINE__, *loaded.Snapshot() == model, "Loaded list differed from the saved one");
+
+    // the view reads the same elements in place
+    {
+        CDS::MappedListView<T> view;
+        CdsUtil::assertf(__LINE__, view.Open(path), "View could not open %s", path.c_str());
+        CdsUtil::assertf(__LINE__, view.Size() == model.size(), "View size was %zu, expected %zu", view.Size(), model.size());
+        size_t i = 0;
+        for (auto element : view)
+        {
+            CdsUtil::assertf(__LINE__, element == model[i], "View element %zu was wrong", i);
+            i++;
+        }
+        CdsUtil::assertf(__LINE__, view[999] == model[999], "View[999] was wrong");
+        CdsUtil::assertf(__LINE__, view.Search(value(500)) && view.IndexOf(value(500)) == 500, "View could not find element 500");
+        CdsUtil::assertf(__LINE__, !view.Search(value(5000)) && view.IndexOf(value(5000)) == view.npos, "View found a missing element");
+
+        // saving over a mapped file replaces it, leaving the view intact
+        list.Clear();
+        CdsUtil::assertf(__LINE__, list.Save(path), "Save of an empty list failed");
+        CdsUtil::assertf(__LINE__, view[999] == model[999], "View changed when its file was replaced");
+    }
+
+    CdsUtil::assertf(__LINE__, loaded.Load(path) && loaded.Size() == 0, "Load of an empty list failed");
+    for (size_t i = 0; i < 10; ++i)
+        list.Insert(value(i), list.Size());
+
+    // truncated, corrupt, or missing files are rejected, leaving the list as it was
+    CdsUtil::assertf(__LINE__, list.Save(path), "Save to %s failed", path.c_str());
+    std::ifstream in(path, std::ios::binary);
+    std::string saved((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << saved.substr(0, saved.size() - 1);
+    CdsUtil::assertf(__LINE__, !loaded.Load(path), "Load of a truncated file succeeded");
+    CdsUtil::assertf(__LINE__, loaded.Size() == 0, "Failed Load changed the list");
+
+    loaded.Insert(value(1));
+    CdsUtil::assertf(__LINE__, list.Load(path + ".missing") == false, "Load of a missing file succeeded");
+    for (size_t length : {size_t(0), size_t(10), size_t(100)})
+    {
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << std::string(length, '\x01');
+        CdsUtil::assertf(__LINE__, !loaded.Load(path), "Load of %zu bytes of garbage succeeded", length);
+        CdsUtil::assertf(__LINE__, loaded.Size() == 1, "Failed Load changed the list");
+        CDS::MappedListView<T> view;
+        CdsUtil::assertf(__LINE__, !view.Open(path) && view.Size() == 0, "View opened %zu bytes of garbage", length);
+    }
+    std::remove(path.c_str());
+}
+
+template <typename C>
+void
+CdsTest::TestPushPop(bool fifo)
+{
+    static_assert(CDS::IsDataStructure<C, uint32_t>::value, "Container does not satisfy CDS::IsDataStructure");
+    C container;
+    uint32_t out = 0;
+    CdsUtil::assertf(__LINE__, !container.TryPop(out) && container.Size() == 0, "Empty container popped a value");
+
+    // IDataStructure members, while quiescent
+    for (uint32_t i = 1; i <= 100; ++i)
+        container.Push(i);
+    CdsUtil::assertf(__LINE__, container.Size() == 100, "Size was %zu after 100 pushes", container.Size());
+    CdsUtil::assertf(__LINE__, container.Search(50) && !container.Search(1000), "Search disagreed");
+    CdsUtil::assertf(__LINE__, container.Remove(50) && !container.Remove(50), "Remove disagreed");
+    CdsUtil::assertf(__LINE__, container.Size() == 99 && !container.Search(50), "Remove left size %zu", container.Size());
+
+    // pop order, skipping the removed value
+    uint32_t expected = fifo ? 1 : 100;
+    while (container.TryPop(out))
+    {
+        if (expected == 50)
+            expected = fifo ? 51 : 49;
+        CdsUtil::assertf(__LINE__, out == expected, "Popped %u, expected %u", out, expected);
+        expected = fifo ? expected + 1 : expected - 1;
+    }
+    CdsUtil::assertf(__LINE__, container.Size() == 0, "Size was %zu after draining", container.Size());
+
+    // batches keep their order
+    std::vector<uint32_t> batch(64);
+    for (uint32_t i = 0; i < 64; ++i)
+        batch[i] = i;
+    CdsUtil::assertf(__LINE__, container.PushN(batch.begin(), batch.end()) == 64, "PushN pushed a partial batch");
+    std::vector<uint32_t> popped;
+    CdsUtil::assertf(__LINE__, container.PopN(std::back_inserter(popped), 40) == 40, "PopN popped the wrong count");
+    CdsUtil::assertf(__LINE__, popped.front() == (fifo ? 0u : 63u) && popped.back() == (fifo ? 39u : 24u), "PopN order was wrong");
+    container.Clear();
+    CdsUtil::assertf(__LINE__, container.Size() == 0 && !container.TryPop(out), "Clear left elements behind");
+
+    // producers tag values with their id, consumers record what they get
+    const uint32_t producers = 3;
+    const uint32_t consumers = 3;
+    const uint32_t perProducer = 3000;
+    std::atomic<uint32_t> taken(0);
+    std::vector<std::vector<uint32_t>> seen(consumers);
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back(
+            [&container, p, perProducer]()
+            {
+                for (uint32_t i = 0; i < perProducer;)
+                {
+                    // alternate single pushes with batches of 8
+                    if (i % 16 == 0 && i + 8 <= perProducer)
+                    {
+                        uint32_t run[8];
+                        for (uint32_t k = 0; k < 8; ++k)
+                            run[k] = (p << 24) | (i + k);
+                        uint32_t* first = run;
+                        while (first != run + 8)
+                            first += container.PushN(first, run + 8);
+                        i += 8;
+                    }
+                    else
+                    {
+                        container.Push((p << 24) | i);
+                        i++;
+                    }
+                }
+            });
+    }
+    for (uint32_t c = 0; c < consumers; ++c)
+    {
+        threads.emplace_back(
+            [&container, &taken, &seen, c, producers, perProducer]()
+            {
+                uint32_t value;
+                while (taken.load() < producers * perProducer)
+                {
+                    if (c == 0)
+                    {
+                        size_t n = container.PopN(std::back_inserter(seen[c]), 4);
+                        taken.fetch_add(static_cast<uint32_t>(n));
+                        if (n == 0)
+                            std::this_thread::yield();
+                    }
+                    else if (container.TryPop(value))
+                    {
+                        seen[c].push_back(value);
+                        taken.fetch_add(1);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+    for (std::thread& t : threads)
+        t.join();
+
+    // every value arrives exactly once. In a queue, each consumer also sees
+    // each producer's values in the order they were pushed.
+    std::vector<uint32_t> counts(producers * perProducer, 0);
+    for (const std::vector<uint32_t>& values : seen)
+    {
+        std::vector<int64_t> last(producers, -1);
+        for (uint32_t value : values)
+        {
+            uint32_t p = value >> 24;
+            uint32_t i = value & 0xFFFFFF;
+            CdsUtil::assertf(__LINE__, p < producers && i < perProducer, "Popped a value never pushed: %u", value);
+            counts[p * perProducer + i]++;
+            if (fifo)
+            {
+                CdsUtil::assertf(__LINE__, static_cast<int64_t>(i) > last[p], "Producer %u's values arrived out of order", p);
+                last[p] = i;
+            }
+        }
+    }
+    for (size_t i = 0; i < counts.size(); ++i)
+        CdsUtil::assertf(__LINE__, counts[i] == 1, "Value %zu was popped %u times", i, counts[i]);
+    CdsUtil::assertf(__LINE__, container.Size() == 0, "Size was %zu after the race", container.Size());
+}
+
+template <typename C>
+void
+CdsTest::TestElementOwnership()
+{
+    C container;
+    std::string value = CdsUtil::string_generator();
+    std::string copy = value;
+    container.Push(std::move(value));
+    CdsUtil::assertf(__LINE__, value.empty(), "Push(T&&) copied instead of moving");
+
+    std::string out;
+    CdsUtil::assertf(__LINE__, container.TryPop(out) && out == copy, "Popped string was wrong");
+
+    // leave some behind for Clear, and some for the destructor
+    for (int i = 0; i < 50; ++i)
+        container.Push(CdsUtil::string_generator() + std::string(64, 'x'));
+    container.Clear();
+    for (int i = 0; i < 50; ++i)
+        container.Push(CdsUtil::string_generator() + std::string(64, 'x'));
+    container.Pop(out);
+    CdsUtil::assertf(__LINE__, container.Size() == 49 && out.size() == 74, "Container lost strings");
+}
+
+template <typename Tr>
+void
+CdsTest::TestOrderedTree()
+{
+    static_assert(CDS::IsDataStructure<Tr, uint32_t>::value && !CDS::IsList<Tr, uint32_t>::value, "Tree has the wrong static interface");
+    Tr tree;
+    std::set<uint32_t> model;
+    CdsUtil::assertf(__LINE__, tree.Size() == 0 && tree.Height() == 1 && !tree.Search(0), "New tree was not empty");
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        uint32_t value = CdsUtil::rand_range(0, 5000);
+        switch (CdsUtil::rand_range(0, 2))
+        {
+        case 0:
+            CdsUtil::assertf(__LINE__, tree.Insert(value) == model.insert(value).second, "Insert(%u) disagreed", value);
+            break;
+        case 1:
+            CdsUtil::assertf(__LINE__, tree.Remove(value) == (model.erase(value) == 1), "Remove(%u) disagreed", value);
+            break;
+        default:
+            CdsUtil::assertf(__LINE__, tree.Search(value) == (model.count(value) == 1), "Search(%u) disagreed", value);
+            break;
+        }
+        CdsUtil::assertf(__LINE__, tree.Size() == model.size(), "Size was %zu, expected %zu", tree.Size(), model.size());
+
+        if (i % 500 == 0)
+        {
+            uint32_t low = CdsUtil::rand_range(0, 5000);
+            uint32_t high = low + CdsUtil::rand_range(0, 1000);
+            std::vector<uint32_t> found;
+            size_t count = tree.RangeQuery(low, high, found);
+            std::vector<uint32_t> expected(model.lower_bound(low), model.upper_bound(high));
+            CdsUtil::assertf(__LINE__, count == found.size() && found == expected, "RangeQuery [%u, %u] disagreed", low, high);
+        }
+    }
+    CdsUtil::assertf(__LINE__, tree.Height() > 1, "Tree never grew past one level");
+
+    // a full scan visits everything in order
+    std::vector<uint32_t> all;
+    tree.RangeQuery(0, UINT32_MAX, all);
+    CdsUtil::assertf(__LINE__, std::equal(all.begin(), all.end(), model.begin(), model.end()), "Full scan disagreed");
+
+    // bulk load replaces the contents, and the tree keeps working afterward
+    std::vector<uint32_t> sorted;
+    for (uint32_t i = 0; i < 100000; i += 2)
+        sorted.push_back(i);
+    CdsUtil::assertf(__LINE__, tree.BulkLoad(sorted.begin(), sorted.end()), "BulkLoad rejected sorted input");
+    CdsUtil::assertf(__LINE__, tree.Size() == sorted.size(), "BulkLoad left size %zu", tree.Size());
+    CdsUtil::assertf(__LINE__, tree.Search(5000) && !tree.Search(5001), "BulkLoad contents were wrong");
+
+    std::vector<uint32_t> unsorted = {1, 5, 3};
+    std::vector<uint32_t> repeated = {1, 3, 3};
+    CdsUtil::assertf(__LINE__, !tree.BulkLoad(unsorted.begin(), unsorted.end()) && !tree.BulkLoad(repeated.begin(), repeated.end()), "BulkLoad accepted bad input");
+    CdsUtil::assertf(__LINE__, tree.Size() == sorted.size(), "Rejected BulkLoad changed the tree");
+
+    for (uint32_t i = 1; i < 100000; i += 20)
+        CdsUtil::assertf(__LINE__, tree.Insert(i), "Insert(%u) after BulkLoad failed", i);
+    for (uint32_t i = 0; i < 100000; i += 10)
+        CdsUtil::assertf(__LINE__, tree.Remove(i), "Remove(%u) after BulkLoad failed", i);
+    all.clear();
+    tree.RangeQuery(0, UINT32_MAX, all);
+    CdsUtil::assertf(__LINE__, all.size() == tree.Size() && std::is_sorted(all.begin(), all.end()), "Tree was out of order after BulkLoad");
+    CdsUtil::assertf(__LINE__, tree.Size() == 50000 + 5000 - 10000, "Size was %zu after BulkLoad edits", tree.Size());
+
+    tree.Clear();
+    CdsUtil::assertf(__LINE__, tree.Size() == 0 && tree.Height() == 1 && !tree.Search(2), "Clear left keys behind");
+    CdsUtil::assertf(__LINE__, tree.Insert(7) && tree.Search(7), "Insert after Clear failed");
+    CdsUtil::assertf(__LINE__, tree.BulkLoad(sorted.end(), sorted.end()) && tree.Size() == 0, "Empty BulkLoad was wrong");
+}
+
+template <typename Tr>
+void
+CdsTest::TestConcurrentTree()
+{
+    // multiples of 3 stay put; writer w owns the keys equal to w + 1 mod 3
+    const uint32_t limit = 30000;
+    std::vector<uint32_t> stable;
+    for (uint32_t i = 0; i < limit; i += 3)
+        stable.push_back(i);
+
+    Tr tree;
+    tree.BulkLoad(stable.begin(), stable.end());
+
+    std::atomic<bool> done(false);
+    std::vector<std::thread> threads;
+    for (uint32_t w = 0; w < 2; ++w)
+    {
+        threads.emplace_back(
+            [&tree, w, limit]()
+            {
+                for (int round = 0; round < 2; ++round)
+                {
+                    for (uint32_t i = w + 1; i < limit; i += 3)
+                        CdsUtil::assertf(__LINE__, tree.Insert(i), "Concurrent Insert(%u) failed", i);
+                    for (uint32_t i = w + 1; i < limit; i += 3)
+                        CdsUtil::assertf(__LINE__, tree.Remove(i), "Concurrent Remove(%u) failed", i);
+                }
+            });
+    }
+    for (int r = 0; r < 2; ++r)
+    {
+        threads.emplace_back(
+            [&tree, &done, limit]()
+            {
+                while (!done.load())
+                {
+                    uint32_t key = CdsUtil::rand_range(0, limit / 3 - 1) * 3;
+                    CdsUtil::assertf(__LINE__, tree.Search(key), "Stable key %u went missing", key);
+
+                    // every stable key in range shows up, in order, once
+                    std::vector<uint32_t> found;
+                    tree.RangeQuery(key, key + 300, found);
+                    uint32_t expected = key;
+                    for (size_t i = 0; i < found.size(); ++i)
+                    {
+                        CdsUtil::assertf(__LINE__, i == 0 || found[i - 1] < found[i], "RangeQuery was out of order");
+                        if (found[i] == expected)
+                            expected += 3;
+                    }
+                    CdsUtil::assertf(__LINE__, expected > key + 300 || expected >= limit, "RangeQuery skipped stable key %u", expected);
+                }
+            });
+    }
+    threads[0].join();
+    threads[1].join();
+    done.store(true);
+    threads[2].join();
+    threads[3].join();
+
+    CdsUtil::assertf(__LINE__, tree.Size() == stable.size(), "Size was %zu, expected %zu", tree.Size(), stable.size());
+    std::vector<uint32_t> all;
+    tree.RangeQuery(0, limit, all);
+    CdsUtil::assertf(__LINE__, all == stable, "Tree contents were wrong after the race");
+}
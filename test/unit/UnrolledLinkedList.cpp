@@ -0,0 +1,65 @@
+// =================================================================
+// UnrolledLinkedList.cpp
+//  Description     Unit tests for UnrolledLinkedList
+//  Date            2026.10.18
+//  Author          jtpeller
+// =================================================================
+
+#include <unit/Test.hpp>
+#include <cassert>
+#include <iostream>
+#include <libcds/UnrolledLinkedList.hpp>
+#include <thread>
+#include <util.hpp>
+
+template <>
+std::string
+CdsTest::TestList<CDS::UnrolledLinkedList<std::string>, std::string>::Generate()
+{
+    return CdsUtil::string_generator();
+}
+
+template <>
+uint32_t
+CdsTest::TestList<CDS::UnrolledLinkedList<uint32_t>, uint32_t>::Generate()
+{
+    return CdsUtil::rand_range(0, 250);
+}
+
+// wide enough that a node at the default NodeBytes holds the minimum
+struct Wide
+{
+    uint32_t key;
+    unsigned char pad[296];
+
+    explicit Wide(uint32_t value = 0) : key(value), pad() {}
+
+    bool operator==(const Wide& other) const { return key == other.key; }
+};
+
+std::ostream&
+operator<<(std::ostream& out, const Wide& wide)
+{
+    return out << wide.key;
+}
+
+int
+main()
+{
+    printf("Testing UnrolledLinkedList with uint32_t...\n");
+    CdsTest::TestList<CDS::UnrolledLinkedList<uint32_t>, uint32_t> ull_uint32_tester;
+    ull_uint32_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing UnrolledLinkedList with std::string...\n");
+    CdsTest::TestList<CDS::UnrolledLinkedList<std::string>, std::string> ull_str_tester;
+    ull_str_tester.ExecuteManyUnits();
+    printf("OK.\n");
+
+    printf("Testing UnrolledLinkedList with minimum capacity nodes...");
+    static_assert(CDS::UnrolledLinkedList<Wide>::Capacity == 2, "Wide should force the minimum capacity");
+    CdsTest::TestInsertEnds<CDS::UnrolledLinkedList<Wide>, Wide>();
+    CdsTest::TestInsertEnds<CDS::UnrolledLinkedList<uint32_t, 1>, uint32_t>();
+    printf("OK.\n");
+    return 0;
+}